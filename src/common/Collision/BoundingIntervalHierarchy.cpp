@@ -16,6 +16,7 @@
  */
 
 #include "BoundingIntervalHierarchy.h"
+#include "MappedFile.h"
 
 #ifdef _MSC_VER
 #define isnan _isnan
@@ -293,14 +294,43 @@ bool BIH::readFromFile(FILE* rf)
     check += fread(&hi, sizeof(float), 3, rf);
     bounds = G3D::AABox(lo, hi);
     check += fread(&treeSize, sizeof(uint32), 1, rf);
-    tree.resize(treeSize);
-    check += fread(&tree[0], sizeof(uint32), treeSize, rf);
+    std::vector<uint32>& treeData = tree.Own();
+    treeData.resize(treeSize);
+    check += fread(treeData.data(), sizeof(uint32), treeSize, rf);
     check += fread(&count, sizeof(uint32), 1, rf);
-    objects.resize(count); // = new uint32[nObjects];
-    check += fread(&objects[0], sizeof(uint32), count, rf);
+    std::vector<uint32>& objectData = objects.Own();
+    objectData.resize(count); // = new uint32[nObjects];
+    check += fread(objectData.data(), sizeof(uint32), count, rf);
     return uint64(check) == uint64(3 + 3 + 1 + 1 + uint64(treeSize) + uint64(count));
 }
 
+bool BIH::readFromMappedFile(MappedFileReader& reader)
+{
+    G3D::Vector3 lo, hi;
+    uint32 treeSize = 0, count = 0;
+    if (!reader.Read(lo) || !reader.Read(hi) || !reader.Read(treeSize))
+    {
+        return false;
+    }
+    bounds = G3D::AABox(lo, hi);
+
+    uint32 const* treeData = reader.ReadArray<uint32>(treeSize);
+    if (!treeData || !reader.Read(count))
+    {
+        return false;
+    }
+
+    uint32 const* objectData = reader.ReadArray<uint32>(count);
+    if (!objectData)
+    {
+        return false;
+    }
+
+    tree.Map(treeData, treeSize);
+    objects.Map(objectData, count);
+    return true;
+}
+
 void BIH::BuildStats::updateLeaf(int depth, int n)
 {
     numLeaves++;
@@ -23,6 +23,7 @@
 #include "G3D/Vector3.h"
 
 #include "Define.h"
+#include "MappableArray.h"
 
 #include <algorithm>
 #include <cmath>
@@ -33,6 +34,8 @@
 
 #define MAX_STACK_SIZE 64
 
+class MappedFileReader;
+
 // https://stackoverflow.com/a/4328396
 
 static inline uint32 floatToRawIntBits(float f)
@@ -68,11 +71,12 @@ class BIH
 private:
     void init_empty()
     {
-        tree.clear();
-        objects.clear();
+        std::vector<uint32>& treeData = tree.Own();
+        treeData.clear();
+        objects.Own().clear();
         // create space for the first node
-        tree.push_back(3u << 30u); // dummy leaf
-        tree.insert(tree.end(), 2, 0);
+        treeData.push_back(3u << 30u); // dummy leaf
+        treeData.insert(treeData.end(), 2, 0);
     }
 public:
     BIH() { init_empty(); }
@@ -105,13 +109,9 @@ public:
             stats.printStats();
         }
 
-        objects.resize(dat.numPrims);
-        for (uint32 i = 0; i < dat.numPrims; ++i)
-        {
-            objects[i] = dat.indices[i];
-        }
+        objects.Own().assign(dat.indices, dat.indices + dat.numPrims);
         //nObjects = dat.numPrims;
-        tree = tempTree;
+        tree.Own().swap(tempTree);
         delete[] dat.primBound;
         delete[] dat.indices;
     }
@@ -372,12 +372,109 @@ public:
         }
     }
 
+    //! calls intersectCallback(entry) once for every object stored in a leaf overlapping box
+    template<typename BoxCallback>
+    void intersectBox(const G3D::AABox& box, BoxCallback& intersectCallback) const
+    {
+        if (!bounds.intersects(box))
+        {
+            return;
+        }
+
+        const G3D::Vector3& lo = box.low();
+        const G3D::Vector3& hi = box.high();
+        StackNode stack[MAX_STACK_SIZE];
+        int stackPos = 0;
+        int node = 0;
+
+        while (true)
+        {
+            while (true)
+            {
+                uint32 tn = tree[node];
+                uint32 axis = (tn & (3 << 30)) >> 30; // cppcheck-suppress integerOverflow
+                bool BVH2 = tn & (1 << 29); // cppcheck-suppress integerOverflow
+                int offset = tn & ~(7 << 29); // cppcheck-suppress integerOverflow
+                if (!BVH2)
+                {
+                    if (axis < 3)
+                    {
+                        // "normal" interior node, left child ends at tl and right child starts at tr
+                        float tl = intBitsToFloat(tree[node + 1]);
+                        float tr = intBitsToFloat(tree[node + 2]);
+                        bool left = lo[axis] <= tl;
+                        bool right = hi[axis] >= tr;
+                        int rightNode = offset + 3;
+                        if (left && right)
+                        {
+                            // box overlaps both nodes, push back right node
+                            stack[stackPos].node = rightNode;
+                            stackPos++;
+                            node = offset;
+                            continue;
+                        }
+                        if (left)
+                        {
+                            node = offset;
+                            continue;
+                        }
+                        if (right)
+                        {
+                            node = rightNode;
+                            continue;
+                        }
+                        // box is between clip zones
+                        break;
+                    }
+                    else
+                    {
+                        // leaf - report all objects
+                        int n = tree[node + 1];
+                        while (n > 0)
+                        {
+                            intersectCallback(objects[offset]);
+                            --n;
+                            ++offset;
+                        }
+                        break;
+                    }
+                }
+                else // BVH2 node (empty space cut off left and right)
+                {
+                    if (axis > 2)
+                    {
+                        return;    // should not happen
+                    }
+                    float tl = intBitsToFloat(tree[node + 1]);
+                    float tr = intBitsToFloat(tree[node + 2]);
+                    node = offset;
+                    if (tl > hi[axis] || tr < lo[axis])
+                    {
+                        break;
+                    }
+                    continue;
+                }
+            } // traversal loop
+
+            // stack is empty?
+            if (stackPos == 0)
+            {
+                return;
+            }
+            // move back up the stack
+            stackPos--;
+            node = stack[stackPos].node;
+        }
+    }
+
     bool writeToFile(FILE* wf) const;
     bool readFromFile(FILE* rf);
+    //! uses the node and object arrays in place, they must be 4 byte aligned in the mapping
+    bool readFromMappedFile(MappedFileReader& reader);
 
 protected:
-    std::vector<uint32> tree;
-    std::vector<uint32> objects;
+    MappableArray<uint32> tree;
+    MappableArray<uint32> objects;
     G3D::AABox bounds;
 
     struct buildData
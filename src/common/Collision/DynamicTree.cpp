@@ -291,6 +291,24 @@ bool DynamicMapTree::isInLineOfSight(float x1, float y1, float z1, float x2, flo
     return !callback.didHit();
 }
 
+void DynamicMapTree::isInLineOfSight(std::vector<VMAP::LineOfSightSegment>& segments, uint32 phasemask, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    // gameobject models are few and spread over a grid, each segment only walks the cells it crosses
+    if (!size())
+    {
+        return;
+    }
+
+    for (VMAP::LineOfSightSegment& segment : segments)
+    {
+        if (segment.inLineOfSight)
+        {
+            segment.inLineOfSight = isInLineOfSight(segment.start.x, segment.start.y, segment.start.z,
+                segment.end.x, segment.end.y, segment.end.z, phasemask, ignoreFlags);
+        }
+    }
+}
+
 float DynamicMapTree::getHeight(float x, float y, float z, float maxSearchDist, uint32 phasemask) const
 {
     G3D::Vector3 v(x, y, z);
@@ -19,6 +19,7 @@
 #define _DYNTREE_H
 
 #include "Define.h"
+#include <vector>
 
 namespace G3D
 {
@@ -29,6 +30,7 @@ namespace G3D
 namespace VMAP
 {
     struct AreaAndLiquidData;
+    struct LineOfSightSegment;
     enum class ModelIgnoreFlags : uint32;
 }
 
@@ -44,6 +46,7 @@ public:
     ~DynamicMapTree();
 
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    void isInLineOfSight(std::vector<VMAP::LineOfSightSegment>& segments, uint32 phasemask, VMAP::ModelIgnoreFlags ignoreFlags) const;
 
     bool GetIntersectionTime(uint32 phasemask, const G3D::Ray& ray, const G3D::Vector3& endPos, float& maxDist) const;
 
@@ -21,7 +21,9 @@
 #include "Define.h"
 #include "ModelIgnoreFlags.h"
 #include "Optional.h"
+#include <G3D/Vector3.h>
 #include <string>
+#include <vector>
 
 //===========================================================
 
@@ -73,6 +75,18 @@ namespace VMAP
         Optional<LiquidInfo> liquidInfo;
     };
 
+    /// One ray of a batched line of sight query, inLineOfSight is cleared once something blocks it.
+    /// Segments that are already blocked are skipped, so several trees can be queried in turn.
+    struct LineOfSightSegment
+    {
+        LineOfSightSegment() = default;
+        LineOfSightSegment(G3D::Vector3 const& _start, G3D::Vector3 const& _end)
+            : start(_start), end(_end) { }
+        G3D::Vector3 start;
+        G3D::Vector3 end;
+        bool inLineOfSight = true;
+    };
+
     //===========================================================
     class IVMapMgr
     {
@@ -194,6 +194,41 @@ namespace VMAP
         return true;
     }
 
+    void VMapMgr2::isInLineOfSight(unsigned int mapId, std::vector<LineOfSightSegment>& segments, ModelIgnoreFlags ignoreFlags)
+    {
+#if defined(ENABLE_VMAP_CHECKS)
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+        {
+            return;
+        }
+#endif
+
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+        {
+            return;
+        }
+
+        std::vector<LineOfSightSegment> internalSegments;
+        internalSegments.reserve(segments.size());
+        for (LineOfSightSegment const& segment : segments)
+        {
+            internalSegments.emplace_back(convertPositionToInternalRep(segment.start.x, segment.start.y, segment.start.z),
+                convertPositionToInternalRep(segment.end.x, segment.end.y, segment.end.z));
+            internalSegments.back().inLineOfSight = segment.inLineOfSight && internalSegments.back().start != internalSegments.back().end;
+        }
+
+        instanceTree->second->isInLineOfSight(internalSegments, ignoreFlags);
+
+        for (std::size_t i = 0; i < segments.size(); ++i)
+        {
+            if (segments[i].inLineOfSight && internalSegments[i].start != internalSegments[i].end)
+            {
+                segments[i].inLineOfSight = internalSegments[i].inLineOfSight;
+            }
+        }
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
@@ -346,7 +381,7 @@ namespace VMAP
         if (model == iLoadedModelFiles.end())
         {
             WorldModel* worldmodel = new WorldModel();
-            if (!worldmodel->readFile(basepath + filename + ".vmo"))
+            if (!worldmodel->readFile(basepath + filename + ".vmo", iEnableMemoryMappedModels))
             {
                 LOG_ERROR("maps", "VMapMgr2: could not load '{}{}.vmo'", basepath, filename);
                 delete worldmodel;
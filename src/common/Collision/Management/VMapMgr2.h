@@ -79,6 +79,7 @@ namespace VMAP
         ModelFileMap iLoadedModelFiles;
         InstanceTreeMap iInstanceMapTrees;
         bool thread_safe_environment;
+        bool iEnableMemoryMappedModels{false};
 
         // Mutex for iLoadedModelFiles
         std::mutex LoadedModelFilesLock;
@@ -108,6 +109,10 @@ namespace VMAP
 
         bool isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) override ;
         /**
+        batched isInLineOfSight for many segments in the same area, positions are in world coordinates
+        */
+        void isInLineOfSight(unsigned int mapId, std::vector<LineOfSightSegment>& segments, ModelIgnoreFlags ignoreFlags);
+        /**
         fill the hit pos and return true, if an object was hit
         */
         bool GetObjectHitPos(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist) override;
@@ -119,6 +124,12 @@ namespace VMAP
         bool GetLiquidLevel(uint32 pMapId, float x, float y, float z, uint8 reqLiquidType, float& level, float& floor, uint32& type, uint32& mogpFlags) const override;
         void GetAreaAndLiquidData(uint32 mapId, float x, float y, float z, uint8 reqLiquidType, AreaAndLiquidData& data) const override;
 
+        /**
+        Use .vmo geometry in place from a read-only memory mapping instead of copying it to the heap.
+        Only applies to models loaded afterwards and to files written in the aligned format.
+        */
+        void setEnableMemoryMappedModels(bool enable) { iEnableMemoryMappedModels = enable; }
+
         WorldModel* acquireModelInstance(const std::string& basepath, const std::string& filename, uint32 flags);
         void releaseModelInstance(const std::string& filename);
 
@@ -0,0 +1,80 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAPPABLEARRAY_H
+#define _MAPPABLEARRAY_H
+
+#include <cstddef>
+#include <vector>
+
+/// Read-only array that either owns its elements or points into a memory
+/// mapped file. Mapped storage is used in place; the mapping must outlive it.
+/// Copies always own their data so they never depend on another object's mapping.
+template<class T>
+class MappableArray
+{
+public:
+    MappableArray() = default;
+    MappableArray(MappableArray const& other) : _owned(other.begin(), other.end()) { }
+    MappableArray& operator=(MappableArray const& other)
+    {
+        if (this != &other)
+        {
+            std::vector<T>(other.begin(), other.end()).swap(_owned);
+            _mapped = nullptr;
+            _mappedSize = 0;
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t size() const { return _mapped ? _mappedSize : _owned.size(); }
+    [[nodiscard]] bool empty() const { return size() == 0; }
+    [[nodiscard]] T const* data() const { return _mapped ? _mapped : _owned.data(); }
+    [[nodiscard]] T const* begin() const { return data(); }
+    [[nodiscard]] T const* end() const { return data() + size(); }
+    T const& operator[](std::size_t index) const { return data()[index]; }
+
+    [[nodiscard]] bool IsMapped() const { return _mapped != nullptr; }
+
+    /// Detaches from the mapping, copying its elements, and returns the owned storage for writing
+    std::vector<T>& Own()
+    {
+        if (_mapped)
+        {
+            _owned.assign(_mapped, _mapped + _mappedSize);
+            _mapped = nullptr;
+            _mappedSize = 0;
+        }
+        return _owned;
+    }
+
+    /// Uses count elements at data in place, releasing owned storage
+    void Map(T const* data, std::size_t count)
+    {
+        std::vector<T>().swap(_owned);
+        _mapped = data;
+        _mappedSize = count;
+    }
+
+private:
+    std::vector<T> _owned;
+    T const* _mapped = nullptr;
+    std::size_t _mappedSize = 0;
+};
+
+#endif
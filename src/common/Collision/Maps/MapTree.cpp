@@ -17,6 +17,7 @@
 
 #include "MapTree.h"
 #include "Errors.h"
+#include "IVMapMgr.h"
 #include "Log.h"
 #include "Metric.h"
 #include "ModelInstance.h"
@@ -178,6 +179,161 @@ namespace VMAP
 
         return !GetIntersectionTime(ray, maxDist, true, ignoreFlags);
     }
+
+    // above this many models near a batch, testing every segment against all of them costs more than separate traversals
+    static constexpr std::size_t MAX_BATCH_LOS_CANDIDATES = 256;
+
+    class BatchLineOfSightCallback
+    {
+    public:
+        BatchLineOfSightCallback(ModelInstance* val): prims(val) { }
+        void operator()(uint32 entry)
+        {
+            if (candidates.size() <= MAX_BATCH_LOS_CANDIDATES && prims[entry].getWorldModel())
+            {
+                candidates.push_back(entry);
+            }
+        }
+
+        ModelInstance* prims;
+        std::vector<uint32> candidates;
+    };
+
+    /**
+    All models whose bounds overlap the segments are collected with a single traversal of the tree.
+    Each segment is then checked against their bounds in a branch free loop the compiler can vectorize,
+    and only models it actually crosses within its length are intersected exactly.
+    */
+    void StaticMapTree::isInLineOfSight(std::vector<LineOfSightSegment>& segments, ModelIgnoreFlags ignoreFlags) const
+    {
+        G3D::AABox bundle;
+        uint32 pending = 0;
+        for (LineOfSightSegment const& segment : segments)
+        {
+            if (!segment.inLineOfSight)
+            {
+                continue;
+            }
+
+            if (!pending++)
+            {
+                bundle = G3D::AABox(segment.start.min(segment.end), segment.start.max(segment.end));
+            }
+            else
+            {
+                bundle.merge(segment.start);
+                bundle.merge(segment.end);
+            }
+        }
+
+        if (!pending)
+        {
+            return;
+        }
+
+        BatchLineOfSightCallback callback(iTreeValues);
+        if (pending > 1)
+        {
+            iTree.intersectBox(bundle, callback);
+        }
+
+        if (pending == 1 || callback.candidates.size() > MAX_BATCH_LOS_CANDIDATES)
+        {
+            for (LineOfSightSegment& segment : segments)
+            {
+                if (segment.inLineOfSight)
+                {
+                    segment.inLineOfSight = isInLineOfSight(segment.start, segment.end, ignoreFlags);
+                }
+            }
+            return;
+        }
+
+        std::size_t const count = callback.candidates.size();
+        if (!count)
+        {
+            return;
+        }
+
+        // bounds as separate arrays, slightly grown so float rounding can not skip a model the exact test would hit
+        static constexpr float BOUNDS_EPSILON = 0.01f;
+        std::vector<float> lo[3], hi[3];
+        for (uint8 axis = 0; axis < 3; ++axis)
+        {
+            lo[axis].resize(count);
+            hi[axis].resize(count);
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            G3D::AABox const& bounds = iTreeValues[callback.candidates[i]].GetBounds();
+            for (uint8 axis = 0; axis < 3; ++axis)
+            {
+                lo[axis][i] = bounds.low()[axis] - BOUNDS_EPSILON;
+                hi[axis][i] = bounds.high()[axis] + BOUNDS_EPSILON;
+            }
+        }
+
+        std::vector<uint8> crosses(count);
+        for (LineOfSightSegment& segment : segments)
+        {
+            if (!segment.inLineOfSight)
+            {
+                continue;
+            }
+
+            Vector3 const delta = segment.end - segment.start;
+            float maxDist = delta.magnitude();
+            // same guards as the single segment query
+            if (maxDist == std::numeric_limits<float>::max() || !std::isfinite(maxDist))
+            {
+                segment.inLineOfSight = false;
+                continue;
+            }
+
+            if (maxDist < 1e-10f)
+            {
+                continue;
+            }
+
+            Vector3 const dir = delta / maxDist;
+            float origin[3] = { segment.start.x, segment.start.y, segment.start.z };
+            float invDir[3];
+            for (uint8 axis = 0; axis < 3; ++axis)
+            {
+                // a huge finite value instead of inf avoids 0 * inf = NaN for rays starting on a bound plane
+                invDir[axis] = 1.0f / (dir[axis] != 0.0f ? dir[axis] : 1e-30f);
+            }
+
+            float const* loX = lo[0].data();
+            float const* loY = lo[1].data();
+            float const* loZ = lo[2].data();
+            float const* hiX = hi[0].data();
+            float const* hiY = hi[1].data();
+            float const* hiZ = hi[2].data();
+            uint8* cross = crosses.data();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                float tx1 = (loX[i] - origin[0]) * invDir[0], tx2 = (hiX[i] - origin[0]) * invDir[0];
+                float ty1 = (loY[i] - origin[1]) * invDir[1], ty2 = (hiY[i] - origin[1]) * invDir[1];
+                float tz1 = (loZ[i] - origin[2]) * invDir[2], tz2 = (hiZ[i] - origin[2]) * invDir[2];
+                float tNear = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::min(tz1, tz2));
+                float tFar = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::max(tz1, tz2));
+                cross[i] = uint8(tNear <= tFar) & uint8(tFar >= 0.0f) & uint8(tNear <= maxDist);
+            }
+
+            G3D::Ray ray = G3D::Ray::fromOriginAndDirection(segment.start, dir);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                float distance = maxDist;
+                if (cross[i] && iTreeValues[callback.candidates[i]].intersectRay(ray, distance, true, ignoreFlags))
+                {
+                    segment.inLineOfSight = false;
+                    break;
+                }
+            }
+        }
+    }
     //=========================================================
     /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
@@ -21,12 +21,14 @@
 #include "BoundingIntervalHierarchy.h"
 #include "Define.h"
 #include <unordered_map>
+#include <vector>
 
 namespace VMAP
 {
     class ModelInstance;
     class GroupModel;
     class VMapMgr2;
+    struct LineOfSightSegment;
     enum class ModelIgnoreFlags : uint32;
     enum class LoadResult : uint8;
 
@@ -71,6 +73,8 @@ namespace VMAP
         ~StaticMapTree();
 
         [[nodiscard]] bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2, ModelIgnoreFlags ignoreFlags) const;
+        //! batched isInLineOfSight, collects nearby models once for all segments
+        void isInLineOfSight(std::vector<LineOfSightSegment>& segments, ModelIgnoreFlags ignoreFlags) const;
         bool GetObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
         [[nodiscard]] float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
         bool GetAreaInfo(G3D::Vector3& pos, uint32& flags, int32& adtId, int32& rootId, int32& groupId) const;
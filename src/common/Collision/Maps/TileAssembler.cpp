@@ -607,4 +607,63 @@ namespace VMAP
     // drop of temporary use defines
 #undef READ_OR_RETURN
 #undef CMP_OR_RETURN
+
+    bool TileAssembler::convertModelFiles(const std::string& vmapDir)
+    {
+        boost::system::error_code ec;
+        boost::filesystem::directory_iterator dirItr(vmapDir, ec);
+        if (ec)
+        {
+            printf("Cannot open directory %s\n", vmapDir.c_str());
+            return false;
+        }
+
+        uint32 converted = 0, skipped = 0;
+        bool success = true;
+        for (; dirItr != boost::filesystem::directory_iterator(); ++dirItr)
+        {
+            boost::filesystem::path const& path = dirItr->path();
+            if (path.extension() != ".vmo" || !boost::filesystem::is_regular_file(path))
+            {
+                continue;
+            }
+
+            std::string const fileName = path.string();
+            char magic[8] = { };
+            if (FILE* rf = fopen(fileName.c_str(), "rb"))
+            {
+                bool aligned = fread(magic, 1, 8, rf) == 8 && !memcmp(magic, VMAP_ALIGNED_MAGIC, 8);
+                fclose(rf);
+                if (aligned)
+                {
+                    ++skipped;
+                    continue;
+                }
+            }
+
+            // write next to the original first so a failure never leaves a truncated model behind
+            WorldModel model;
+            std::string const tempName = fileName + ".tmp";
+            if (!model.readFile(fileName) || !model.writeFile(tempName))
+            {
+                printf("Error converting %s\n", fileName.c_str());
+                boost::filesystem::remove(tempName, ec);
+                success = false;
+                continue;
+            }
+
+            boost::filesystem::rename(tempName, path, ec);
+            if (ec)
+            {
+                printf("Error replacing %s: %s\n", fileName.c_str(), ec.message().c_str());
+                success = false;
+                continue;
+            }
+
+            ++converted;
+        }
+
+        printf("Converted %u model files, %u were already aligned\n", converted, skipped);
+        return success;
+    }
 }
@@ -108,6 +108,9 @@ namespace VMAP
         void exportGameobjectModels();
 
         bool convertRawFile(const std::string& pModelFilename);
+
+        //! rewrites .vmo files of an existing vmap directory in the aligned format that can be memory mapped
+        static bool convertModelFiles(const std::string& vmapDir);
     };
 
 }                                                           // VMAP
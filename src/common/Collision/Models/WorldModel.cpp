@@ -17,6 +17,7 @@
 
 #include "WorldModel.h"
 #include "MapTree.h"
+#include "MappedFile.h"
 #include "ModelIgnoreFlags.h"
 #include "ModelInstance.h"
 #include "VMapDefinitions.h"
@@ -31,7 +32,7 @@ template<> struct BoundsTrait<VMAP::GroupModel>
 
 namespace VMAP
 {
-    bool IntersectTriangle(const MeshTriangle& tri, std::vector<Vector3>::const_iterator points, const G3D::Ray& ray, float& distance)
+    bool IntersectTriangle(const MeshTriangle& tri, const Vector3* points, const G3D::Ray& ray, float& distance)
     {
         static const float EPS = 1e-5f;
 
@@ -87,7 +88,7 @@ namespace VMAP
     class TriBoundFunc
     {
     public:
-        TriBoundFunc(std::vector<Vector3>& vert): vertices(vert.begin()) { }
+        TriBoundFunc(const Vector3* vert): vertices(vert) { }
         void operator()(const MeshTriangle& tri, G3D::AABox& out) const
         {
             G3D::Vector3 lo = vertices[tri.idx0];
@@ -99,7 +100,7 @@ namespace VMAP
             out = G3D::AABox(lo, hi);
         }
     protected:
-        const std::vector<Vector3>::const_iterator vertices;
+        const Vector3* const vertices;
     };
 
     // ===================== WmoLiquid ==================================
@@ -109,64 +110,19 @@ namespace VMAP
     {
         if (width && height)
         {
-            iHeight = new float[(width + 1) * (height + 1)];
-            iFlags = new uint8[width * height];
+            iHeight.Own().resize((width + 1) * (height + 1));
+            iFlags.Own().resize(width * height);
         }
         else
         {
-            iHeight = new float[1];
-            iFlags = nullptr;
+            iHeight.Own().resize(1);
         }
     }
 
-    WmoLiquid::WmoLiquid(const WmoLiquid& other): iHeight(0), iFlags(0)
-    {
-        *this = other; // use assignment operator...
-    }
-
-    WmoLiquid::~WmoLiquid()
-    {
-        delete[] iHeight;
-        delete[] iFlags;
-    }
-
-    WmoLiquid& WmoLiquid::operator=(const WmoLiquid& other)
-    {
-        if (this == &other)
-        {
-            return *this;
-        }
-        iTilesX = other.iTilesX;
-        iTilesY = other.iTilesY;
-        iCorner = other.iCorner;
-        iType = other.iType;
-        delete[] iHeight;
-        delete[] iFlags;
-        if (other.iHeight)
-        {
-            iHeight = new float[(iTilesX + 1) * (iTilesY + 1)];
-            memcpy(iHeight, other.iHeight, (iTilesX + 1) * (iTilesY + 1)*sizeof(float));
-        }
-        else
-        {
-            iHeight = 0;
-        }
-        if (other.iFlags)
-        {
-            iFlags = new uint8[iTilesX * iTilesY];
-            memcpy(iFlags, other.iFlags, iTilesX * iTilesY);
-        }
-        else
-        {
-            iFlags = 0;
-        }
-        return *this;
-    }
-
     bool WmoLiquid::GetLiquidHeight(const Vector3& pos, float& liqHeight) const
     {
         // simple case
-        if (!iFlags)
+        if (iFlags.empty())
         {
             liqHeight = iHeight[0];
             return true;
@@ -187,7 +143,7 @@ namespace VMAP
 
         // check if tile shall be used for liquid level
         // checking for 0x08 *might* be enough, but disabled tiles always are 0x?F:
-        if (iFlags && (iFlags[tx + ty * iTilesX] & 0x0F) == 0x0F)
+        if ((iFlags[tx + ty * iTilesX] & 0x0F) == 0x0F)
         {
             return false;
         }
@@ -209,7 +165,7 @@ namespace VMAP
           0           1
         */
 
-        if (!iHeight)
+        if (iHeight.empty())
         {
             return false;
         }
@@ -235,7 +191,7 @@ namespace VMAP
         return 2 * sizeof(uint32) +
                sizeof(Vector3) +
                sizeof(uint32) +
-               (iFlags ? ((iTilesX + 1) * (iTilesY + 1) * sizeof(float) + iTilesX * iTilesY) : sizeof(float));
+               (!iFlags.empty() ? ((iTilesX + 1) * (iTilesY + 1) * sizeof(float) + iTilesX * iTilesY) : sizeof(float));
     }
 
     bool WmoLiquid::writeToFile(FILE* wf)
@@ -249,14 +205,14 @@ namespace VMAP
             if (iTilesX && iTilesY)
             {
                 uint32 size = (iTilesX + 1) * (iTilesY + 1);
-                if (fwrite(iHeight, sizeof(float), size, wf) == size)
+                if (fwrite(iHeight.data(), sizeof(float), size, wf) == size)
                 {
                     size = iTilesX * iTilesY;
-                    result = fwrite(iFlags, sizeof(uint8), size, wf) == size;
+                    result = fwrite(iFlags.data(), sizeof(uint8), size, wf) == size;
                 }
             }
             else
-                result = fwrite(iHeight, sizeof(float), 1, wf) == 1;
+                result = fwrite(iHeight.data(), sizeof(float), 1, wf) == 1;
         }
 
         return result;
@@ -275,18 +231,62 @@ namespace VMAP
             if (liquid->iTilesX && liquid->iTilesY)
             {
                 uint32 size = (liquid->iTilesX + 1) * (liquid->iTilesY + 1);
-                liquid->iHeight = new float[size];
-                if (fread(liquid->iHeight, sizeof(float), size, rf) == size)
+                std::vector<float>& heights = liquid->iHeight.Own();
+                heights.resize(size);
+                if (fread(heights.data(), sizeof(float), size, rf) == size)
                 {
                     size = liquid->iTilesX * liquid->iTilesY;
-                    liquid->iFlags = new uint8[size];
-                    result = fread(liquid->iFlags, sizeof(uint8), size, rf) == size;
+                    std::vector<uint8>& flags = liquid->iFlags.Own();
+                    flags.resize(size);
+                    result = fread(flags.data(), sizeof(uint8), size, rf) == size;
                 }
             }
             else
             {
-                liquid->iHeight = new float[1];
-                result = fread(liquid->iHeight, sizeof(float), 1, rf) == 1;
+                std::vector<float>& heights = liquid->iHeight.Own();
+                heights.resize(1);
+                result = fread(heights.data(), sizeof(float), 1, rf) == 1;
+            }
+        }
+
+        if (!result)
+        {
+            delete liquid;
+        }
+        else
+        {
+            out = liquid;
+        }
+
+        return result;
+    }
+
+    bool WmoLiquid::readFromMappedFile(MappedFileReader& reader, WmoLiquid*& out)
+    {
+        bool result = false;
+        WmoLiquid* liquid = new WmoLiquid();
+
+        if (reader.Read(liquid->iTilesX) && reader.Read(liquid->iTilesY) &&
+                reader.Read(liquid->iCorner) && reader.Read(liquid->iType))
+        {
+            if (liquid->iTilesX && liquid->iTilesY)
+            {
+                uint32 size = (liquid->iTilesX + 1) * (liquid->iTilesY + 1);
+                if (float const* heights = reader.ReadArray<float>(size))
+                {
+                    liquid->iHeight.Map(heights, size);
+                    size = liquid->iTilesX * liquid->iTilesY;
+                    if (uint8 const* flags = reader.ReadArray<uint8>(size))
+                    {
+                        liquid->iFlags.Map(flags, size);
+                        result = true;
+                    }
+                }
+            }
+            else if (float const* height = reader.ReadArray<float>(1))
+            {
+                liquid->iHeight.Map(height, 1);
+                result = true;
             }
         }
 
@@ -323,9 +323,9 @@ namespace VMAP
 
     void GroupModel::setMeshData(std::vector<Vector3>& vert, std::vector<MeshTriangle>& tri)
     {
-        vertices.swap(vert);
-        triangles.swap(tri);
-        TriBoundFunc bFunc(vertices);
+        vertices.Own().swap(vert);
+        triangles.Own().swap(tri);
+        TriBoundFunc bFunc(vertices.data());
         meshTree.build(triangles, bFunc);
     }
 
@@ -348,7 +348,7 @@ namespace VMAP
         {
             return result;
         }
-        if (result && fwrite(&vertices[0], sizeof(Vector3), count, wf) != count) { result = false; }
+        if (result && fwrite(vertices.data(), sizeof(Vector3), count, wf) != count) { result = false; }
 
         // write triangle mesh
         if (result && fwrite("TRIM", 1, 4, wf) != 4) { result = false; }
@@ -356,7 +356,7 @@ namespace VMAP
         chunkSize = sizeof(uint32) + sizeof(MeshTriangle) * count;
         if (result && fwrite(&chunkSize, sizeof(uint32), 1, wf) != 1) { result = false; }
         if (result && fwrite(&count, sizeof(uint32), 1, wf) != 1) { result = false; }
-        if (result && fwrite(&triangles[0], sizeof(MeshTriangle), count, wf) != count) { result = false; }
+        if (result && fwrite(triangles.data(), sizeof(MeshTriangle), count, wf) != count) { result = false; }
 
         // write mesh BIH
         if (result && fwrite("MBIH", 1, 4, wf) != 4) { result = false; }
@@ -374,17 +374,24 @@ namespace VMAP
         if (result && fwrite(&chunkSize, sizeof(uint32), 1, wf) != 1) { result = false; }
         if (result) { result = iLiquid->writeToFile(wf); }
 
+        // the liquid flags are bytes, pad so the next group model stays 4 byte aligned
+        static const char padding[4] = { };
+        long offset = result ? ftell(wf) : -1;
+        if (offset < 0) { result = false; }
+        uint32 paddingSize = result ? (4 - offset % 4) % 4 : 0;
+        if (result && fwrite(padding, 1, paddingSize, wf) != paddingSize) { result = false; }
+
         return result;
     }
 
-    bool GroupModel::readFromFile(FILE* rf)
+    bool GroupModel::readFromFile(FILE* rf, bool aligned)
     {
         char chunk[8];
         bool result = true;
         uint32 chunkSize = 0;
         uint32 count = 0;
-        triangles.clear();
-        vertices.clear();
+        triangles.Own().clear();
+        vertices.Own().clear();
         delete iLiquid;
         iLiquid = nullptr;
 
@@ -400,15 +407,15 @@ namespace VMAP
         {
             return result;
         }
-        if (result) { vertices.resize(count); }
-        if (result && fread(&vertices[0], sizeof(Vector3), count, rf) != count) { result = false; }
+        if (result) { vertices.Own().resize(count); }
+        if (result && fread(vertices.Own().data(), sizeof(Vector3), count, rf) != count) { result = false; }
 
         // read triangle mesh
         if (result && !readChunk(rf, chunk, "TRIM", 4)) { result = false; }
         if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) { result = false; }
         if (result && fread(&count, sizeof(uint32), 1, rf) != 1) { result = false; }
-        if (result) { triangles.resize(count); }
-        if (result && fread(&triangles[0], sizeof(MeshTriangle), count, rf) != count) { result = false; }
+        if (result) { triangles.Own().resize(count); }
+        if (result && fread(triangles.Own().data(), sizeof(MeshTriangle), count, rf) != count) { result = false; }
 
         // read mesh BIH
         if (result && !readChunk(rf, chunk, "MBIH", 4)) { result = false; }
@@ -420,22 +427,88 @@ namespace VMAP
         if (result && chunkSize > 0)
         {
             result = WmoLiquid::readFromFile(rf, iLiquid);
+            long offset = result && aligned ? ftell(rf) : 0;
+            if (offset < 0 || (offset % 4 && fseek(rf, 4 - offset % 4, SEEK_CUR) != 0)) { result = false; }
         }
         return result;
     }
 
+    bool GroupModel::readFromMappedFile(MappedFileReader& reader)
+    {
+        uint32 chunkSize = 0;
+        uint32 count = 0;
+        triangles.Map(nullptr, 0);
+        vertices.Map(nullptr, 0);
+        delete iLiquid;
+        iLiquid = nullptr;
+
+        if (!reader.Read(iBound) || !reader.Read(iMogpFlags) || !reader.Read(iGroupWMOID))
+        {
+            return false;
+        }
+
+        // vertices
+        if (!reader.ReadChunk("VERT", 4) || !reader.Read(chunkSize) || !reader.Read(count))
+        {
+            return false;
+        }
+        if (!count) // models without (collision) geometry end here, unsure if they are useful
+        {
+            return true;
+        }
+        Vector3 const* vertexData = reader.ReadArray<Vector3>(count);
+        if (!vertexData)
+        {
+            return false;
+        }
+        vertices.Map(vertexData, count);
+
+        // triangle mesh
+        if (!reader.ReadChunk("TRIM", 4) || !reader.Read(chunkSize) || !reader.Read(count))
+        {
+            return false;
+        }
+        MeshTriangle const* triangleData = reader.ReadArray<MeshTriangle>(count);
+        if (!triangleData)
+        {
+            return false;
+        }
+        triangles.Map(triangleData, count);
+
+        // mesh BIH
+        if (!reader.ReadChunk("MBIH", 4) || !meshTree.readFromMappedFile(reader))
+        {
+            return false;
+        }
+
+        // liquid data
+        if (!reader.ReadChunk("LIQU", 4) || !reader.Read(chunkSize))
+        {
+            return false;
+        }
+        if (chunkSize > 0)
+        {
+            if (!WmoLiquid::readFromMappedFile(reader, iLiquid))
+            {
+                return false;
+            }
+            reader.Align(4);
+        }
+        return true;
+    }
+
     struct GModelRayCallback
     {
-        GModelRayCallback(const std::vector<MeshTriangle>& tris, const std::vector<Vector3>& vert):
-            vertices(vert.begin()), triangles(tris.begin()), hit(false) { }
+        GModelRayCallback(const MeshTriangle* tris, const Vector3* vert):
+            vertices(vert), triangles(tris), hit(false) { }
         bool operator()(const G3D::Ray& ray, uint32 entry, float& distance, bool /*StopAtFirstHit*/)
         {
             bool result = IntersectTriangle(triangles[entry], vertices, ray, distance);
             if (result) { hit = true; }
             return hit;
         }
-        std::vector<Vector3>::const_iterator vertices;
-        std::vector<MeshTriangle>::const_iterator triangles;
+        const Vector3* vertices;
+        const MeshTriangle* triangles;
         bool hit;
     };
 
@@ -446,7 +519,7 @@ namespace VMAP
             return false;
         }
 
-        GModelRayCallback callback(triangles, vertices);
+        GModelRayCallback callback(triangles.data(), vertices.data());
         meshTree.intersectRay(ray, callback, distance, stopAtFirstHit);
         return callback.hit;
     }
@@ -488,13 +561,17 @@ namespace VMAP
 
     void GroupModel::GetMeshData(std::vector<G3D::Vector3>& outVertices, std::vector<MeshTriangle>& outTriangles, WmoLiquid*& liquid)
     {
-        outVertices = vertices;
-        outTriangles = triangles;
+        outVertices.assign(vertices.begin(), vertices.end());
+        outTriangles.assign(triangles.begin(), triangles.end());
         liquid = iLiquid;
     }
 
     // ===================== WorldModel ==================================
 
+    WorldModel::WorldModel() = default;
+
+    WorldModel::~WorldModel() = default;
+
     void WorldModel::setGroupModels(std::vector<GroupModel>& models)
     {
         groupModels.swap(models);
@@ -625,7 +702,7 @@ namespace VMAP
         }
 
         uint32 chunkSize, count;
-        bool result = fwrite(VMAP_MAGIC, 1, 8, wf) == 8;
+        bool result = fwrite(VMAP_ALIGNED_MAGIC, 1, 8, wf) == 8;
         if (result && fwrite("WMOD", 1, 4, wf) != 4) { result = false; }
         chunkSize = sizeof(uint32) + sizeof(uint32);
         if (result && fwrite(&chunkSize, sizeof(uint32), 1, wf) != 1) { result = false; }
@@ -653,8 +730,13 @@ namespace VMAP
         return result;
     }
 
-    bool WorldModel::readFile(const std::string& filename)
+    bool WorldModel::readFile(const std::string& filename, bool memoryMapped)
     {
+        if (memoryMapped && readMappedFile(filename))
+        {
+            return true;
+        }
+
         FILE* rf = fopen(filename.c_str(), "rb");
         if (!rf)
         {
@@ -665,7 +747,10 @@ namespace VMAP
         uint32 chunkSize = 0;
         uint32 count = 0;
         char chunk[8];                          // Ignore the added magic header
-        if (!readChunk(rf, chunk, VMAP_MAGIC, 8)) { result = false; }
+        bool aligned = false;
+        if (fread(chunk, 1, 8, rf) != 8) { result = false; }
+        else if (!memcmp(chunk, VMAP_ALIGNED_MAGIC, 8)) { aligned = true; }
+        else if (memcmp(chunk, VMAP_MAGIC, 8)) { result = false; }
 
         if (result && !readChunk(rf, chunk, "WMOD", 4)) { result = false; }
         if (result && fread(&chunkSize, sizeof(uint32), 1, rf) != 1) { result = false; }
@@ -681,7 +766,7 @@ namespace VMAP
             //if (result && fread(&groupModels[0], sizeof(GroupModel), count, rf) != count) result = false;
             for (uint32 i = 0; i < count && result; ++i)
             {
-                result = groupModels[i].readFromFile(rf);
+                result = groupModels[i].readFromFile(rf, aligned);
             }
 
             // read group BIH
@@ -693,6 +778,48 @@ namespace VMAP
         return result;
     }
 
+    bool WorldModel::readMappedFile(const std::string& filename)
+    {
+        mappedFile = std::make_unique<MappedFile>();
+        if (!mappedFile->Open(filename))
+        {
+            mappedFile.reset();
+            return false;
+        }
+
+        // files in the old unaligned format are left to the regular loader
+        MappedFileReader reader(*mappedFile);
+        bool result = reader.ReadChunk(VMAP_ALIGNED_MAGIC, 8);
+
+        uint32 chunkSize = 0;
+        uint32 count = 0;
+        result = result && reader.ReadChunk("WMOD", 4) && reader.Read(chunkSize) && reader.Read(RootWMOID);
+
+        // group models
+        if (result && reader.ReadChunk("GMOD", 4))
+        {
+            result = reader.Read(count);
+            if (result) { groupModels.resize(count); }
+            for (uint32 i = 0; i < count && result; ++i)
+            {
+                result = groupModels[i].readFromMappedFile(reader);
+            }
+
+            // group BIH
+            result = result && reader.ReadChunk("GBIH", 4) && groupTree.readFromMappedFile(reader);
+        }
+
+        if (!result)
+        {
+            // nothing may keep pointing into the mapping once it is closed
+            groupModels.clear();
+            groupTree = BIH();
+            mappedFile.reset();
+        }
+
+        return result;
+    }
+
     void WorldModel::GetGroupModels(std::vector<GroupModel>& outGroupModels)
     {
         outGroupModels = groupModels;
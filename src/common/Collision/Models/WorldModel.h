@@ -20,9 +20,14 @@
 
 #include "BoundingIntervalHierarchy.h"
 #include "Define.h"
+#include "MappableArray.h"
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
+#include <memory>
+
+class MappedFile;
+class MappedFileReader;
 
 namespace VMAP
 {
@@ -46,16 +51,14 @@ namespace VMAP
     {
     public:
         WmoLiquid(uint32 width, uint32 height, const G3D::Vector3& corner, uint32 type);
-        WmoLiquid(const WmoLiquid& other);
-        ~WmoLiquid();
-        WmoLiquid& operator=(const WmoLiquid& other);
         bool GetLiquidHeight(const G3D::Vector3& pos, float& liqHeight) const;
         [[nodiscard]] uint32 GetType() const { return iType; }
-        float* GetHeightStorage() { return iHeight; }
-        uint8* GetFlagsStorage() { return iFlags; }
+        float* GetHeightStorage() { return iHeight.Own().data(); }
+        uint8* GetFlagsStorage() { return iFlags.empty() ? nullptr : iFlags.Own().data(); }
         uint32 GetFileSize();
         bool writeToFile(FILE* wf);
         static bool readFromFile(FILE* rf, WmoLiquid*& liquid);
+        static bool readFromMappedFile(MappedFileReader& reader, WmoLiquid*& liquid);
         void GetPosInfo(uint32& tilesX, uint32& tilesY, G3D::Vector3& corner) const;
     private:
         WmoLiquid() { }
@@ -63,8 +66,8 @@ namespace VMAP
         uint32 iTilesY{0};
         G3D::Vector3 iCorner;    //!< the lower corner
         uint32 iType{0};         //!< liquid type
-        float* iHeight{nullptr}; //!< (tilesX + 1)*(tilesY + 1) height values
-        uint8* iFlags{nullptr};  //!< info if liquid tile is used
+        MappableArray<float> iHeight; //!< (tilesX + 1)*(tilesY + 1) height values
+        MappableArray<uint8> iFlags;  //!< info if liquid tile is used
     };
 
     /*! holding additional info for WMO group files */
@@ -85,7 +88,8 @@ namespace VMAP
         bool GetLiquidLevel(const G3D::Vector3& pos, float& liqHeight) const;
         [[nodiscard]] uint32 GetLiquidType() const;
         bool writeToFile(FILE* wf);
-        bool readFromFile(FILE* rf);
+        bool readFromFile(FILE* rf, bool aligned = false);
+        bool readFromMappedFile(MappedFileReader& reader);
         [[nodiscard]] const G3D::AABox& GetBound() const { return iBound; }
         [[nodiscard]] uint32 GetMogpFlags() const { return iMogpFlags; }
         [[nodiscard]] uint32 GetWmoID() const { return iGroupWMOID; }
@@ -94,8 +98,8 @@ namespace VMAP
         G3D::AABox iBound;
         uint32 iMogpFlags{0};// 0x8 outdor; 0x2000 indoor
         uint32 iGroupWMOID{0};
-        std::vector<G3D::Vector3> vertices;
-        std::vector<MeshTriangle> triangles;
+        MappableArray<G3D::Vector3> vertices;
+        MappableArray<MeshTriangle> triangles;
         BIH meshTree;
         WmoLiquid* iLiquid{nullptr};
     };
@@ -103,7 +107,8 @@ namespace VMAP
     class WorldModel
     {
     public:
-        WorldModel() { }
+        WorldModel();
+        ~WorldModel();
 
         //! pass group models to WorldModel and create BIH. Passed vector is swapped with old geometry!
         void setGroupModels(std::vector<GroupModel>& models);
@@ -112,13 +117,17 @@ namespace VMAP
         bool IntersectPoint(const G3D::Vector3& p, const G3D::Vector3& down, float& dist, AreaInfo& info) const;
         bool GetLocationInfo(const G3D::Vector3& p, const G3D::Vector3& down, float& dist, LocationInfo& info) const;
         bool writeFile(const std::string& filename);
-        bool readFile(const std::string& filename);
+        //! memoryMapped uses geometry in place from files written in the aligned format, others are read normally
+        bool readFile(const std::string& filename, bool memoryMapped = false);
         void GetGroupModels(std::vector<GroupModel>& outGroupModels);
         uint32 Flags;
     protected:
+        bool readMappedFile(const std::string& filename);
+
         uint32 RootWMOID{0};
         std::vector<GroupModel> groupModels;
         BIH groupTree;
+        std::unique_ptr<MappedFile> mappedFile;
     };
 } // namespace VMAP
 
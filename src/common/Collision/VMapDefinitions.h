@@ -23,6 +23,7 @@
 namespace VMAP
 {
     const char VMAP_MAGIC[] = "VMAP_4.7";
+    const char VMAP_ALIGNED_MAGIC[] = "VMAPA4.7";           // .vmo files with 4 byte aligned arrays, usable from a memory mapping
     const char RAW_VMAP_MAGIC[] = "VMAP047";                // used in extracted vmap files with raw data
     const char GAMEOBJECT_MODELS[] = "GameObjectModels.dtree";
 
@@ -17,17 +17,19 @@
 
 #include "DBCFileLoader.h"
 #include "Errors.h"
+#include "MappedFile.h"
 #include <stdio.h>
 #include <string.h>
 
-DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
+DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr), ownsData(false) { }
 
 bool DBCFileLoader::Load(char const* filename, char const* fmt)
 {
     uint32 header;
     if (data)
     {
-        delete [] data;
+        if (ownsData)
+            delete [] data;
         data = nullptr;
     }
 
@@ -83,6 +85,75 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
 
     EndianConvert(stringSize);
 
+    CalculateFieldOffsets(fmt);
+
+    data = new unsigned char[recordSize * recordCount + stringSize];
+    stringTable = data + recordSize * recordCount;
+    ownsData = true;
+
+    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
+    {
+        fclose(f);
+        return false;
+    }
+
+    fclose(f);
+
+    return true;
+}
+
+bool DBCFileLoader::Load(MappedFile const& file, char const* fmt)
+{
+    if (data)
+    {
+        if (ownsData)
+            delete [] data;
+        data = nullptr;
+    }
+
+    // records may be patched after loading, a read only mapping would fault
+    uint8* fileData = file.GetWritableData();
+    if (!fileData)
+    {
+        return false;
+    }
+
+    MappedFileReader reader(file);
+    uint32 header;
+    if (!reader.Read(header) || !reader.Read(recordCount) || !reader.Read(fieldCount) || !reader.Read(recordSize) || !reader.Read(stringSize))
+    {
+        return false;
+    }
+
+    EndianConvert(header);
+    EndianConvert(recordCount);
+    EndianConvert(fieldCount);
+    EndianConvert(recordSize);
+    EndianConvert(stringSize);
+
+    if (header != 0x43424457)                                //'WDBC'
+    {
+        return false;
+    }
+
+    if (uint64(recordSize) * recordCount + stringSize > file.GetSize() - reader.GetOffset())
+    {
+        return false;
+    }
+
+    CalculateFieldOffsets(fmt);
+
+    data = fileData + reader.GetOffset();
+    stringTable = data + recordSize * recordCount;
+    ownsData = false;
+
+    return true;
+}
+
+void DBCFileLoader::CalculateFieldOffsets(char const* fmt)
+{
+    delete[] fieldsOffset;
+
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -98,24 +169,12 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
             fieldsOffset[i] += sizeof(uint32);
         }
     }
-
-    data = new unsigned char[recordSize * recordCount + stringSize];
-    stringTable = data + recordSize * recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
-    return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
+    if (ownsData)
+        delete[] data;
 
     delete[] fieldsOffset;
 }
@@ -187,7 +246,6 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     this func will generate  entry[rows] data;
     */
 
-    typedef char* ptr;
     if (strlen(format) != fieldCount)
     {
         return nullptr;
@@ -197,29 +255,7 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     int32 i;
     uint32 recordsize = GetFormatRecordSize(format, &i);
 
-    if (i >= 0)
-    {
-        uint32 maxi = 0;
-        //find max index
-        for (uint32 y = 0; y < recordCount; ++y)
-        {
-            uint32 ind = getRecord(y).getUInt(i);
-            if (ind > maxi)
-            {
-                maxi = ind;
-            }
-        }
-
-        ++maxi;
-        records = maxi;
-        indexTable = new ptr[maxi];
-        memset(indexTable, 0, maxi * sizeof(ptr));
-    }
-    else
-    {
-        records = recordCount;
-        indexTable = new ptr[recordCount];
-    }
+    indexTable = CreateIndexTable(i, records);
 
     char* dataTable = new char[recordCount * recordsize];
 
@@ -274,6 +310,92 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     return dataTable;
 }
 
+char** DBCFileLoader::CreateIndexTable(int32 indexPos, uint32& records)
+{
+    typedef char* ptr;
+    if (indexPos >= 0)
+    {
+        uint32 maxi = 0;
+        //find max index
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            uint32 ind = getRecord(y).getUInt(indexPos);
+            if (ind > maxi)
+            {
+                maxi = ind;
+            }
+        }
+
+        records = maxi + 1;
+    }
+    else
+    {
+        records = recordCount;
+    }
+
+    ptr* indexTable = new ptr[records];
+    memset(indexTable, 0, records * sizeof(ptr));
+    return indexTable;
+}
+
+bool DBCFileLoader::CanUseRecordsInPlace(char const* format) const
+{
+#if ACORE_ENDIAN == ACORE_BIGENDIAN
+    return false;
+#else
+    if (!data || strlen(format) != fieldCount || recordSize % sizeof(uint32) != 0)
+    {
+        return false;
+    }
+
+    // fields kept in memory must all come first and have their on disk size,
+    // unused trailing fields are skipped by stepping records with the on disk record size
+    uint32 x = 0;
+    while (format[x] == FT_IND || format[x] == FT_INT || format[x] == FT_FLOAT || format[x] == FT_BYTE)
+    {
+        ++x;
+    }
+
+    if (!x)
+    {
+        return false;
+    }
+
+    for (; format[x]; ++x)
+    {
+        if (format[x] != FT_NA && format[x] != FT_NA_BYTE)
+        {
+            return false;
+        }
+    }
+
+    return GetFormatRecordSize(format) <= recordSize;
+#endif
+}
+
+void DBCFileLoader::MapData(char const* format, uint32& records, char**& indexTable)
+{
+    ASSERT(CanUseRecordsInPlace(format));
+
+    int32 i;
+    GetFormatRecordSize(format, &i);
+
+    indexTable = CreateIndexTable(i, records);
+
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        char* record = reinterpret_cast<char*>(data + y * recordSize);
+        if (i >= 0)
+        {
+            indexTable[getRecord(y).getUInt(i)] = record;
+        }
+        else
+        {
+            indexTable[y] = record;
+        }
+    }
+}
+
 char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
 {
     if (strlen(format) != fieldCount)
@@ -284,6 +406,25 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
     char* stringPool = new char[stringSize];
     memcpy(stringPool, stringTable, stringSize);
 
+    FillStrings(format, dataTable, stringPool);
+
+    return stringPool;
+}
+
+bool DBCFileLoader::MapStrings(char const* format, char* dataTable)
+{
+    if (strlen(format) != fieldCount || !strchr(format, FT_STRING))
+    {
+        return false;
+    }
+
+    FillStrings(format, dataTable, reinterpret_cast<char*>(stringTable));
+
+    return true;
+}
+
+void DBCFileLoader::FillStrings(char const* format, char* dataTable, char* stringPool)
+{
     uint32 offset = 0;
 
     for (uint32 y = 0; y < recordCount; ++y)
@@ -327,6 +468,4 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
             }
         }
     }
-
-    return stringPool;
 }
@@ -22,6 +22,8 @@
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
 
+class MappedFile;
+
 enum DbcFieldFormat
 {
     FT_NA = 'x',                                              //not used or unknown, 4 byte size
@@ -42,6 +44,8 @@ public:
     ~DBCFileLoader();
 
     bool Load(const char* filename, const char* fmt);
+    // Uses records and strings of a copy on write mapped file in place, the file must outlive the produced data
+    bool Load(MappedFile const& file, const char* fmt);
 
     class Record
     {
@@ -96,7 +100,18 @@ public:
     char* AutoProduceStrings(char const* fmt, char* dataTable);
     static uint32 GetFormatRecordSize(const char* format, int32* index_pos = nullptr);
 
+    // True if fmt describes the leading bytes of each record as they are on disk, so records can be used without conversion
+    [[nodiscard]] bool CanUseRecordsInPlace(char const* fmt) const;
+    // Fills indexTable with pointers to the loaded records, requires CanUseRecordsInPlace
+    void MapData(char const* fmt, uint32& count, char**& indexTable);
+    // Points string fields of dataTable into the loaded string block, returns false if fmt has no strings
+    bool MapStrings(char const* fmt, char* dataTable);
+
 private:
+    void CalculateFieldOffsets(char const* fmt);
+    char** CreateIndexTable(int32 indexPos, uint32& count);
+    void FillStrings(char const* fmt, char* dataTable, char* stringPool);
+
     uint32 recordSize;
     uint32 recordCount;
     uint32 fieldCount;
@@ -104,6 +119,7 @@ private:
     uint32* fieldsOffset;
     unsigned char* data;
     unsigned char* stringTable;
+    bool ownsData;
 
     DBCFileLoader(DBCFileLoader const& right) = delete;
     DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
@@ -0,0 +1,244 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPMCQueue_h__
+#define MPMCQueue_h__
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+// C++ implementation of Dmitry Vyukov's bounded MPMC queue
+// https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+// Producers and consumers never lock each other out while the ring has room, the sleep mutex is
+// only used to put consumers to sleep while the queue is empty and to wake them up again.
+// The queue itself is unbounded: elements that do not fit into the ring spill into a locked
+// overflow list, and everything pushed after them follows them there until it is drained,
+// so producers never wait and the order is kept.
+template<typename T>
+class MPMCQueue
+{
+public:
+    explicit MPMCQueue(std::size_t capacity) : _mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1), _cells(new Cell[_mask + 1]),
+        _enqueuePos(0), _dequeuePos(0), _overflowSize(0), _sleepingConsumers(0), _shutdown(false)
+    {
+        for (std::size_t i = 0; i <= _mask; ++i)
+            _cells[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /// Adds an element without ever waiting. Returns false if it had to go to the overflow list.
+    bool Push(T const& value)
+    {
+        if (_overflowSize.load(std::memory_order_acquire) == 0 && TryPushRing(value))
+            return true;
+
+        {
+            std::lock_guard<std::mutex> lock(_overflowLock);
+            _overflow.push_back(value);
+            _overflowSize.fetch_add(1, std::memory_order_release);
+        }
+
+        WakeConsumer();
+        return false;
+    }
+
+    /// Removes the oldest element, returns false if the queue is empty
+    bool TryPop(T& value)
+    {
+        if (TryPopRing(value))
+            return true;
+
+        if (_overflowSize.load(std::memory_order_acquire) == 0)
+            return false;
+
+        std::lock_guard<std::mutex> lock(_overflowLock);
+        if (_overflow.empty())
+            return false;
+
+        value = std::move(_overflow.front());
+        _overflow.pop_front();
+        _overflowSize.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    /// Removes up to maxCount elements in queue order, returns how many were removed
+    std::size_t PopBulk(T* values, std::size_t maxCount)
+    {
+        std::size_t count = 0;
+        while (count < maxCount && TryPop(values[count]))
+            ++count;
+
+        return count;
+    }
+
+    /// Blocks until at least one element is available, returns 0 only when the queue is canceled
+    std::size_t WaitAndPopBulk(T* values, std::size_t maxCount)
+    {
+        for (;;)
+        {
+            if (_shutdown)
+                return 0;
+
+            if (std::size_t count = PopBulk(values, maxCount))
+                return count;
+
+            std::unique_lock<std::mutex> lock(_sleepLock);
+            _sleepingConsumers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (!_shutdown && Empty())
+                _sleepCondition.wait(lock);
+
+            _sleepingConsumers.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] bool Empty() const
+    {
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        std::size_t seq = _cells[pos & _mask].Sequence.load(std::memory_order_acquire);
+        return std::intptr_t(seq) - std::intptr_t(pos + 1) < 0 && _overflowSize.load(std::memory_order_acquire) == 0;
+    }
+
+    /// Approximate number of queued elements, including the overflow list
+    [[nodiscard]] std::size_t Size() const
+    {
+        std::size_t dequeuePos = _dequeuePos.load(std::memory_order_relaxed);
+        std::size_t enqueuePos = _enqueuePos.load(std::memory_order_relaxed);
+        return (enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0) + _overflowSize.load(std::memory_order_relaxed);
+    }
+
+    /// Number of elements the ring holds before spilling into the overflow list
+    [[nodiscard]] std::size_t Capacity() const { return _mask + 1; }
+
+    /// Deletes queued elements (if they are pointers) and wakes up all waiting consumers
+    void Cancel()
+    {
+        _shutdown = true;
+
+        T value;
+        while (TryPop(value))
+            DeleteQueuedObject(value);
+
+        std::lock_guard<std::mutex> lock(_sleepLock);
+        _sleepCondition.notify_all();
+    }
+
+private:
+    bool TryPushRing(T const& value)
+    {
+        Cell* cell;
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &_cells[pos & _mask];
+            std::size_t seq = cell->Sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = std::intptr_t(seq) - std::intptr_t(pos);
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+
+        cell->Data = value;
+        cell->Sequence.store(pos + 1, std::memory_order_release);
+
+        WakeConsumer();
+        return true;
+    }
+
+    void WakeConsumer()
+    {
+        // pairs with the fence in WaitAndPopBulk, either we see the sleeper or it sees our element
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleepingConsumers.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(_sleepLock);
+            _sleepCondition.notify_one();
+        }
+    }
+
+    bool TryPopRing(T& value)
+    {
+        Cell* cell;
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &_cells[pos & _mask];
+            std::size_t seq = cell->Sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = std::intptr_t(seq) - std::intptr_t(pos + 1);
+            if (diff == 0)
+            {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false;
+            else
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+        }
+
+        value = std::move(cell->Data);
+        cell->Sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename E = T>
+    typename std::enable_if<std::is_pointer<E>::value>::type DeleteQueuedObject(E& obj) { delete obj; }
+
+    template<typename E = T>
+    typename std::enable_if<!std::is_pointer<E>::value>::type DeleteQueuedObject(E const& /*obj*/) { }
+
+    struct Cell
+    {
+        std::atomic<std::size_t> Sequence;
+        T Data;
+    };
+
+    std::size_t const _mask;
+    std::unique_ptr<Cell[]> const _cells;
+
+    // producers and consumers update different positions, keep them on separate cache lines
+    alignas(64) std::atomic<std::size_t> _enqueuePos;
+    alignas(64) std::atomic<std::size_t> _dequeuePos;
+
+    // elements pushed while the ring was full, or after earlier elements overflowed
+    alignas(64) std::atomic<std::size_t> _overflowSize;
+    std::mutex _overflowLock;
+    std::deque<T> _overflow;
+
+    alignas(64) std::atomic<std::size_t> _sleepingConsumers;
+    std::atomic<bool> _shutdown;
+    std::mutex _sleepLock;
+    std::condition_variable _sleepCondition;
+
+    MPMCQueue(MPMCQueue const&) = delete;
+    MPMCQueue& operator=(MPMCQueue const&) = delete;
+};
+
+#endif // MPMCQueue_h__
@@ -0,0 +1,194 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DENSE_ID_STORE_H
+#define _DENSE_ID_STORE_H
+
+#include "Define.h"
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Store for templates keyed by a database entry id, filled at load and read on every map thread.
+ *
+ * Values are kept in insertion order in a few large blocks (the first one sized by reserve(),
+ * usually the row count of the loading query) instead of one heap node each, and looked up by
+ * a plain array indexed by id. Blocks never grow past their capacity, so pointers to stored
+ * values stay valid when templates are added later, e.g. by a reload command.
+ * There is no erase: a store is only ever cleared as a whole.
+ */
+template<class T>
+class DenseIdStore
+{
+public:
+    typedef uint32 key_type;
+    typedef T mapped_type;
+    typedef std::pair<uint32 const, T> Entry;
+    typedef Entry value_type;
+
+    template<bool Const>
+    class Iterator
+    {
+        typedef std::conditional_t<Const, std::vector<std::vector<Entry>> const, std::vector<std::vector<Entry>>> Blocks;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::conditional_t<Const, Entry const, Entry>;
+        using pointer = value_type*;
+        using reference = value_type&;
+
+        Iterator(Blocks* blocks, std::size_t block, std::size_t position) : _blocks(blocks), _block(block), _position(position) { }
+
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        Iterator(Iterator<OtherConst> const& other) : _blocks(other._blocks), _block(other._block), _position(other._position) { }
+
+        reference operator*() const { return (*_blocks)[_block][_position]; }
+        pointer operator->() const { return &(*_blocks)[_block][_position]; }
+
+        Iterator& operator++()
+        {
+            if (++_position == (*_blocks)[_block].size())
+            {
+                ++_block;
+                _position = 0;
+            }
+
+            return *this;
+        }
+
+        Iterator operator++(int) { Iterator copy = *this; ++*this; return copy; }
+
+        bool operator==(Iterator const& right) const { return _block == right._block && _position == right._position; }
+        bool operator!=(Iterator const& right) const { return !(*this == right); }
+
+    private:
+        template<bool> friend class Iterator;
+
+        Blocks* _blocks;
+        std::size_t _block;
+        std::size_t _position;
+    };
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    DenseIdStore() = default;
+    DenseIdStore(DenseIdStore const&) = delete;
+    DenseIdStore& operator=(DenseIdStore const&) = delete;
+
+    [[nodiscard]] T* Find(uint32 id)
+    {
+        return id < _index.size() && _index[id] ? &_index[id]->second : nullptr;
+    }
+
+    [[nodiscard]] T const* Find(uint32 id) const
+    {
+        return id < _index.size() && _index[id] ? &_index[id]->second : nullptr;
+    }
+
+    [[nodiscard]] bool Contains(uint32 id) const { return Find(id) != nullptr; }
+
+    // Value of id, default constructed first if missing
+    T& operator[](uint32 id)
+    {
+        if (T* value = Find(id))
+            return *value;
+
+        return Insert(id);
+    }
+
+    // Constructs the value of id from args unless it exists already, returns the value and whether it was added
+    template<class... Args>
+    std::pair<T*, bool> Emplace(uint32 id, Args&&... args)
+    {
+        if (T* value = Find(id))
+            return { value, false };
+
+        return { &Insert(id, std::forward<Args>(args)...), true };
+    }
+
+    // Capacity of the next block, saves the index from growing row by row too
+    void reserve(std::size_t count)
+    {
+        _reserved = std::max(_reserved, count);
+    }
+
+    void clear()
+    {
+        _index.clear();
+        _index.shrink_to_fit();
+        _blocks.clear();
+        _size = 0;
+        _reserved = 0;
+    }
+
+    [[nodiscard]] std::size_t size() const { return _size; }
+    [[nodiscard]] bool empty() const { return _size == 0; }
+
+    // Highest stored id + 1, the length a vector indexed by id would need
+    [[nodiscard]] std::size_t GetIndexSize() const { return _index.size(); }
+
+    // Memory held by the store itself, not counting allocations owned by the values
+    [[nodiscard]] std::size_t GetMemoryUsage() const
+    {
+        std::size_t bytes = _index.capacity() * sizeof(Entry*) + _blocks.capacity() * sizeof(std::vector<Entry>);
+        for (std::vector<Entry> const& block : _blocks)
+            bytes += block.capacity() * sizeof(Entry);
+
+        return bytes;
+    }
+
+    iterator begin() { return iterator(&_blocks, 0, 0); }
+    iterator end() { return iterator(&_blocks, _blocks.size(), 0); }
+    const_iterator begin() const { return const_iterator(&_blocks, 0, 0); }
+    const_iterator end() const { return const_iterator(&_blocks, _blocks.size(), 0); }
+
+private:
+    static constexpr std::size_t MinBlockCapacity = 256;
+
+    template<class... Args>
+    T& Insert(uint32 id, Args&&... args)
+    {
+        if (_blocks.empty() || _blocks.back().size() == _blocks.back().capacity())
+        {
+            std::vector<Entry>& block = _blocks.emplace_back();
+            block.reserve(std::max(MinBlockCapacity, _reserved > _size ? _reserved - _size : 0));
+        }
+
+        // never reallocates, the block was reserved above
+        Entry& value = _blocks.back().emplace_back(std::piecewise_construct, std::forward_as_tuple(id), std::forward_as_tuple(std::forward<Args>(args)...));
+
+        if (id >= _index.size())
+            _index.resize(id + 1, nullptr);
+
+        _index[id] = &value;
+        ++_size;
+        return value.second;
+    }
+
+    std::vector<Entry*> _index;                         // id -> stored value, nullptr if missing
+    std::vector<std::vector<Entry>> _blocks;
+    std::size_t _size = 0;
+    std::size_t _reserved = 0;
+};
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MappedFile.h"
+
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+
+bool MappedFile::Open(std::string const& path, bool copyOnWrite)
+{
+    Close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return false;
+
+    void* data = MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    _mapping = mapping;
+    _data = static_cast<uint8 const*>(data);
+    _size = std::size_t(size.QuadPart);
+    _copyOnWrite = copyOnWrite;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (_data)
+        UnmapViewOfFile(_data);
+
+    if (_mapping)
+        CloseHandle(_mapping);
+
+    _data = nullptr;
+    _mapping = nullptr;
+    _size = 0;
+    _copyOnWrite = false;
+}
+
+#else
+
+bool MappedFile::Open(std::string const& path, bool copyOnWrite)
+{
+    Close();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    // the mapping keeps its own reference to the file
+    void* data = copyOnWrite ? mmap(nullptr, std::size_t(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0)
+        : mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return false;
+
+    // lookups touch a few scattered pages, read-ahead of whole files would defeat lazy loading
+    madvise(data, std::size_t(st.st_size), MADV_RANDOM);
+
+    _data = static_cast<uint8 const*>(data);
+    _size = std::size_t(st.st_size);
+    _copyOnWrite = copyOnWrite;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (_data)
+        munmap(const_cast<uint8*>(_data), _size);
+
+    _data = nullptr;
+    _size = 0;
+    _copyOnWrite = false;
+}
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAPPED_FILE_H_
+#define _MAPPED_FILE_H_
+
+#include "Define.h"
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+/// Read-only memory mapping of a whole file.
+/// Pages are only read from disk when first touched and are shared through
+/// the page cache with every other process mapping the same file.
+class AC_COMMON_API MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    /// Maps the file, returns false if it does not exist or cannot be mapped.
+    /// A copy on write mapping may be modified, touched pages become private and are never written back.
+    bool Open(std::string const& path, bool copyOnWrite = false);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const { return _data != nullptr; }
+    [[nodiscard]] uint8 const* GetData() const { return _data; }
+    [[nodiscard]] uint8* GetWritableData() const { return _copyOnWrite ? const_cast<uint8*>(_data) : nullptr; }
+    [[nodiscard]] std::size_t GetSize() const { return _size; }
+
+    /// Returns count elements of T at offset, nullptr if they are out of bounds or not aligned for T
+    template<class T>
+    [[nodiscard]] T const* GetArray(std::size_t offset, std::size_t count) const
+    {
+        if (offset > _size || count > (_size - offset) / sizeof(T))
+            return nullptr;
+
+        uint8 const* ptr = _data + offset;
+        if (reinterpret_cast<std::uintptr_t>(ptr) % alignof(T) != 0)
+            return nullptr;
+
+        return reinterpret_cast<T const*>(ptr);
+    }
+
+private:
+    uint8 const* _data = nullptr;
+    std::size_t _size = 0;
+    bool _copyOnWrite = false;
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+    void* _mapping = nullptr;
+#endif
+};
+
+/// Sequential cursor over a MappedFile, mirrors the fread style loaders
+class MappedFileReader
+{
+public:
+    explicit MappedFileReader(MappedFile const& file) : _file(file) { }
+
+    /// Returns a pointer to count elements of T in place and advances past them
+    template<class T>
+    T const* ReadArray(std::size_t count)
+    {
+        T const* data = _file.GetArray<T>(_offset, count);
+        if (data)
+            _offset += sizeof(T) * count;
+
+        return data;
+    }
+
+    /// Copies a single value, does not require alignment
+    template<class T>
+    bool Read(T& value)
+    {
+        if (_offset > _file.GetSize() || _file.GetSize() - _offset < sizeof(T))
+            return false;
+
+        std::memcpy(&value, _file.GetData() + _offset, sizeof(T));
+        _offset += sizeof(T);
+        return true;
+    }
+
+    bool ReadChunk(char const* compare, std::size_t len)
+    {
+        if (_offset > _file.GetSize() || _file.GetSize() - _offset < len)
+            return false;
+
+        bool match = std::memcmp(_file.GetData() + _offset, compare, len) == 0;
+        _offset += len;
+        return match;
+    }
+
+    /// Skips padding up to the next multiple of alignment
+    void Align(std::size_t alignment) { _offset = (_offset + alignment - 1) / alignment * alignment; }
+
+    [[nodiscard]] std::size_t GetOffset() const { return _offset; }
+
+private:
+    MappedFile const& _file;
+    std::size_t _offset = 0;
+};
+
+#endif
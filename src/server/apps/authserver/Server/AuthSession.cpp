@@ -278,6 +278,7 @@ void AuthSession::SendPacket(ByteBuffer& packet)
         MessageBuffer buffer(packet.size());
         buffer.Write(packet.contents(), packet.size());
         QueuePacket(std::move(buffer));
+        ScheduleUpdate();
     }
 }
 
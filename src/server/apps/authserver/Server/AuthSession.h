@@ -72,6 +72,7 @@ public:
 
     void Start() override;
     bool Update() override;
+    [[nodiscard]] bool HasPendingWork() const override { return AuthSocket::HasPendingWork() || !_queryProcessor.Empty(); }
 
     void SendPacket(ByteBuffer& packet);
 
@@ -26,6 +26,7 @@
 #include "Banner.h"
 #include "BattlegroundMgr.h"
 #include "BigNumber.h"
+#include "ChannelBroadcastMgr.h"
 #include "CliRunnable.h"
 #include "Common.h"
 #include "Config.h"
@@ -112,7 +113,6 @@ void StopDB();
 bool LoadRealmInfo(Acore::Asio::IoContext& ioContext);
 AsyncAcceptor* StartRaSocketAcceptor(Acore::Asio::IoContext& ioContext);
 void ShutdownCLIThread(std::thread* cliThread);
-void AuctionListingRunnable();
 void WorldUpdateLoop();
 variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile, [[maybe_unused]] std::string& cfg_service);
 
@@ -291,6 +291,8 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        METRIC_VALUE("auction_search_queue", uint64(AsyncAuctionListingMgr::GetQueueSize()));
+        METRIC_VALUE("channel_broadcast_queue", uint64(ChannelBroadcastMgr::GetQueueSize()));
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -305,6 +307,7 @@ int main(int argc, char** argv)
 
     ///- Initialize the World
     sSecretMgr->Initialize();
+    sWorld->SetStartupProfile(vm.count("startup-profile") > 0);
     sWorld->SetInitialWorldSettings();
 
     std::shared_ptr<void> mapManagementHandle(nullptr, [](void*)
@@ -403,14 +406,13 @@ int main(int argc, char** argv)
         cliThread.reset(new std::thread(CliThread), &ShutdownCLIThread);
     }
 
-    // Launch auction listing thread
-    std::shared_ptr<std::thread> auctionListingThread;
-    auctionListingThread.reset(new std::thread(AuctionListingRunnable),
-        [](std::thread* thr)
-    {
-        thr->join();
-        delete thr;
-    });
+    // Launch auction listing service
+    AsyncAuctionListingMgr::Initialize(sWorld->getIntConfig(CONFIG_AUCTION_HOUSE_SEARCH_THREADS), sWorld->getIntConfig(CONFIG_AUCTION_HOUSE_SEARCH_QUEUE_SIZE));
+    std::shared_ptr<void> auctionListingHandle(nullptr, [](void*) { AsyncAuctionListingMgr::Shutdown(); });
+
+    // Launch channel broadcast service
+    ChannelBroadcastMgr::Initialize(sWorld->getIntConfig(CONFIG_CHANNEL_BROADCAST_QUEUE_SIZE));
+    std::shared_ptr<void> channelBroadcastHandle(nullptr, [](void*) { ChannelBroadcastMgr::Shutdown(); });
 
     WorldUpdateLoop();
 
@@ -716,55 +718,6 @@ bool LoadRealmInfo(Acore::Asio::IoContext& ioContext)
     return true;
 }
 
-void AuctionListingRunnable()
-{
-    LOG_INFO("server", "Starting up Auction House Listing thread...");
-
-    while (!World::IsStopped())
-    {
-        Milliseconds diff = AsyncAuctionListingMgr::GetDiff();
-        AsyncAuctionListingMgr::ResetDiff();
-
-        if (!AsyncAuctionListingMgr::GetTempList().empty() || !AsyncAuctionListingMgr::GetList().empty())
-        {
-            {
-                std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetTempLock());
-
-                for (auto const& delayEvent: AsyncAuctionListingMgr::GetTempList())
-                    AsyncAuctionListingMgr::GetList().emplace_back(delayEvent);
-
-                AsyncAuctionListingMgr::GetTempList().clear();
-            }
-
-            for (auto& itr: AsyncAuctionListingMgr::GetList())
-            {
-                if (itr._pickupTimer <= diff)
-                {
-                    itr._pickupTimer = Milliseconds::zero();
-                }
-                else
-                {
-                    itr._pickupTimer -= diff;
-                }
-            }
-
-            for (auto itr = AsyncAuctionListingMgr::GetList().begin(); itr != AsyncAuctionListingMgr::GetList().end(); ++itr)
-            {
-                if ((*itr)._pickupTimer != Milliseconds::zero())
-                    continue;
-
-                if ((*itr).Execute())
-                    AsyncAuctionListingMgr::GetList().erase(itr);
-
-                break;
-            }
-        }
-        std::this_thread::sleep_for(1ms);
-    }
-
-    LOG_INFO("server", "Auction House Listing thread exiting without problems.");
-}
-
 variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile, [[maybe_unused]] std::string& configService)
 {
     options_description all("Allowed options");
@@ -772,6 +725,7 @@ variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile, [
         ("help,h", "print usage message")
         ("version,v", "print version build info")
         ("dry-run,d", "Dry run")
+        ("startup-profile", "log the time of every startup loader and the startup critical path")
         ("config,c", value<fs::path>(&configFile)->default_value(fs::path(sConfigMgr->GetConfigPath() + std::string(_ACORE_CORE_CONFIG))), "use <arg> as configuration file");
 
 #if AC_PLATFORM == AC_PLATFORM_WINDOWS
@@ -54,8 +54,9 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         }
 
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
+        bool const batchWrites = sConfigMgr->GetOption<bool>(name + "Database.BatchWrites", false);
 
-        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads, batchWrites);
 
         if (uint32 error = pool.Open())
         {
@@ -16,10 +16,15 @@
  */
 
 #include "DatabaseWorker.h"
-#include "PCQueue.h"
+#include "Log.h"
+#include "MPMCQueue.h"
+#include "Metric.h"
+#include "MySQLConnection.h"
 #include "SQLOperation.h"
+#include <array>
+#include <mysqld_error.h>
 
-DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection)
+DatabaseWorker::DatabaseWorker(MPMCQueue<SQLOperation*>* newQueue, MySQLConnection* connection)
 {
     _connection = connection;
     _queue = newQueue;
@@ -41,18 +46,99 @@ void DatabaseWorker::WorkerThread()
     if (!_queue)
         return;
 
+    std::array<SQLOperation*, DATABASE_WORKER_BATCH_SIZE> operations;
+
+    // With several workers every one takes a single operation, as before: a worker holding a run of
+    // operations would execute them after later ones that other workers picked up meanwhile
+    std::size_t const batchSize = _connection->GetConnectionInfo().asyncThreads > 1 ? 1 : operations.size();
+
     for (;;)
     {
-        SQLOperation* operation = nullptr;
+        // take everything that is ready (up to the batch size) with one wakeup
+        std::size_t count = _queue->WaitAndPopBulk(operations.data(), batchSize);
+
+        bool batchWrites = _connection->GetConnectionInfo().batchWrites;
+
+        for (std::size_t i = 0; i < count;)
+        {
+            if (_cancelationToken)
+            {
+                for (; i < count; ++i)
+                    delete operations[i];
+
+                return;
+            }
+
+            std::size_t end = i + 1;
+            if (batchWrites && operations[i]->IsBatchableWrite())
+                while (end < count && operations[end]->IsBatchableWrite())
+                    ++end;
 
-        _queue->WaitAndPop(operation);
+            if (end - i > 1)
+            {
+                ExecuteWriteBatch(&operations[i], end - i);
+                i = end;
+                continue;
+            }
 
-        if (_cancelationToken || !operation)
+            operations[i]->SetConnection(_connection);
+            operations[i]->call();
+
+            delete operations[i];
+            ++i;
+        }
+
+        if (_cancelationToken || !count)
             return;
+    }
+}
+
+void DatabaseWorker::ExecuteWriteBatch(SQLOperation** operations, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        operations[i]->SetConnection(_connection);
 
-        operation->SetConnection(_connection);
-        operation->call();
+    // One commit for the whole run instead of one autocommit per statement.
+    // A failing statement only rolls back itself. A deadlock or a lost connection before the commit (the server
+    // drops the open transaction, statements must not be retried alone on the new session) lose the whole
+    // transaction, in that case everything is executed again one by one. A failed commit is not replayed: the
+    // server may have committed before the connection was lost, like a failed autocommit statement it is logged.
+    uint32 const reconnectCount = _connection->GetReconnectCount();
+    _connection->SetRetryAfterReconnect(false);
 
-        delete operation;
+    bool replay = !_connection->BeginTransaction();
+    for (std::size_t i = 0; i < count && !replay; ++i)
+        if (!operations[i]->Execute() && (_connection->GetLastError() == ER_LOCK_DEADLOCK || _connection->GetReconnectCount() != reconnectCount))
+            replay = true;
+
+    bool committed = !replay && _connection->CommitTransaction();
+
+    _connection->SetRetryAfterReconnect(true);
+
+    if (committed)
+    {
+        METRIC_VALUE("db_batched_writes", uint64(count), METRIC_TAG("db", _connection->GetConnectionInfo().database));
+        METRIC_VALUE("db_commits_saved", uint64(count - 1), METRIC_TAG("db", _connection->GetConnectionInfo().database));
+    }
+    else if (!replay)
+    {
+        LOG_ERROR("sql.sql", "Commit of a batch of {} writes failed, its outcome is unknown and the writes are not executed again.", count);
+
+        if (_connection->GetReconnectCount() == reconnectCount)
+            _connection->RollbackTransaction();
+    }
+    else
+    {
+        LOG_WARN("sql.sql", "Batch of {} writes was not committed (deadlock or lost connection), executing them one by one.", count);
+
+        // a new connection has no transaction to roll back
+        if (_connection->GetReconnectCount() == reconnectCount)
+            _connection->RollbackTransaction();
+
+        for (std::size_t i = 0; i < count; ++i)
+            operations[i]->Execute();
     }
+
+    for (std::size_t i = 0; i < count; ++i)
+        delete operations[i];
 }
@@ -23,22 +23,26 @@
 #include <thread>
 
 template <typename T>
-class ProducerConsumerQueue;
+class MPMCQueue;
 
 class MySQLConnection;
 class SQLOperation;
 
+/// Maximum number of queued operations a worker takes at once, only when it is the single async worker of its pool
+#define DATABASE_WORKER_BATCH_SIZE 16
+
 class AC_DATABASE_API DatabaseWorker
 {
 public:
-    DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection);
+    DatabaseWorker(MPMCQueue<SQLOperation*>* newQueue, MySQLConnection* connection);
     ~DatabaseWorker();
 
 private:
-    ProducerConsumerQueue<SQLOperation*>* _queue;
+    MPMCQueue<SQLOperation*>* _queue;
     MySQLConnection* _connection;
 
     void WorkerThread();
+    void ExecuteWriteBatch(SQLOperation** operations, std::size_t count);
     std::thread _workerThread;
 
     std::atomic<bool> _cancelationToken;
@@ -21,9 +21,9 @@
 #include "Errors.h"
 #include "Log.h"
 #include "LoginDatabase.h"
+#include "MPMCQueue.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
-#include "PCQueue.h"
 #include "PreparedStatement.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
@@ -53,7 +53,7 @@ class PingOperation : public SQLOperation
 
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
-    _queue(new ProducerConsumerQueue<SQLOperation*>()),
+    _queue(new MPMCQueue<SQLOperation*>(DATABASE_QUEUE_CAPACITY)),
     _async_threads(0),
     _synch_threads(0)
 {
@@ -80,9 +80,11 @@ DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads)
+void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, bool const batchWrites)
 {
     _connectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
+    _connectionInfo->batchWrites = batchWrites;
+    _connectionInfo->asyncThreads = asyncThreads;
 
     _async_threads = asyncThreads;
     _synch_threads = synchThreads;
@@ -481,6 +483,7 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 template <class T>
 void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
 {
+    // never waits, when the workers fall behind the queue spills into its overflow list
     _queue->Push(op);
 }
 
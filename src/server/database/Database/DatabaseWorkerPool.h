@@ -52,8 +52,14 @@
 */
 #define MIN_MARIADB_SERVER_VERSION "10.5.0"
 
+/**
+* @def DATABASE_QUEUE_CAPACITY
+* Pending asynchronous operations per pool held in the lock-free ring, further ones spill into a locked overflow list
+*/
+#define DATABASE_QUEUE_CAPACITY 65536
+
 template <typename T>
-class ProducerConsumerQueue;
+class MPMCQueue;
 
 class SQLOperation;
 struct MySQLConnectionInfo;
@@ -74,7 +80,7 @@ public:
     DatabaseWorkerPool();
     ~DatabaseWorkerPool();
 
-    void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
+    void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, bool const batchWrites = false);
 
     uint32 Open();
     void Close();
@@ -243,7 +249,7 @@ private:
     [[nodiscard]] std::string_view GetDatabaseName() const;
 
     //! Queue shared by async worker threads.
-    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+    std::unique_ptr<MPMCQueue<SQLOperation*>> _queue;
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
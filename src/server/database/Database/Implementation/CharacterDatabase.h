@@ -531,7 +531,7 @@ public:
 
     //- Constructors for sync and async connections
     CharacterDatabaseConnection(MySQLConnectionInfo& connInfo);
-    CharacterDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
+    CharacterDatabaseConnection(MPMCQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
     ~CharacterDatabaseConnection() override;
 
     //- Loads database type specific prepared statements
@@ -111,7 +111,7 @@ public:
 
     //- Constructors for sync and async connections
     WorldDatabaseConnection(MySQLConnectionInfo& connInfo);
-    WorldDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
+    WorldDatabaseConnection(MPMCQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
     ~WorldDatabaseConnection() override;
 
     //- Loads database type specific prepared statements
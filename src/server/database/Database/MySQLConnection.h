@@ -27,7 +27,7 @@
 #include <vector>
 
 template <typename T>
-class ProducerConsumerQueue;
+class MPMCQueue;
 
 class DatabaseWorker;
 class MySQLPreparedStatement;
@@ -50,6 +50,8 @@ struct AC_DATABASE_API MySQLConnectionInfo
     std::string host;
     std::string port_or_socket;
     std::string ssl;
+    bool batchWrites{false}; //! Group consecutive async one-way writes into one transaction
+    uint8 asyncThreads{1};   //! Number of async connections sharing the queue
 };
 
 class AC_DATABASE_API MySQLConnection
@@ -61,7 +63,7 @@ friend class PingOperation;
 
 public:
     MySQLConnection(MySQLConnectionInfo& connInfo);                               //! Constructor for synchronous connections.
-    MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo);  //! Constructor for asynchronous connections.
+    MySQLConnection(MPMCQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo);  //! Constructor for asynchronous connections.
     virtual ~MySQLConnection();
 
     virtual uint32 Open();
@@ -76,15 +78,23 @@ public:
     bool _Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
     bool _Query(PreparedStatementBase* stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
 
-    void BeginTransaction();
+    bool BeginTransaction();
     void RollbackTransaction();
-    void CommitTransaction();
+    bool CommitTransaction();
     int ExecuteTransaction(std::shared_ptr<TransactionBase> transaction);
     std::size_t EscapeString(char* to, const char* from, std::size_t length);
     void Ping();
 
     uint32 GetLastError();
 
+    /// Number of times the connection was lost and opened again
+    [[nodiscard]] uint32 GetReconnectCount() const { return m_reconnectCount; }
+
+    /// While disabled, a statement that failed because the connection was lost is not executed again on the new one
+    void SetRetryAfterReconnect(bool retry) { m_retryAfterReconnect = retry; }
+
+    [[nodiscard]] MySQLConnectionInfo const& GetConnectionInfo() const { return m_connectionInfo; }
+
 protected:
     /// Tries to acquire lock. If lock is acquired by another thread
     /// the calling parent will just try another connection
@@ -107,9 +117,11 @@ protected:
     bool m_reconnecting;  //! Are we reconnecting?
     bool m_prepareError;  //! Was there any error while preparing statements?
     MySQLHandle* m_Mysql; //! MySQL Handle.
+    uint32 m_reconnectCount;    //! Successful reconnections, a pending transaction is lost on each
+    bool m_retryAfterReconnect; //! Execute statements again after a reconnection?
 
 private:
-    ProducerConsumerQueue<SQLOperation*>* m_queue;      //! Queue shared with other asynchronous connections.
+    MPMCQueue<SQLOperation*>* m_queue;      //! Queue shared with other asynchronous connections.
     std::unique_ptr<DatabaseWorker> m_worker;           //! Core worker task.
     MySQLConnectionInfo& m_connectionInfo;              //! Connection info (used for logging)
     ConnectionFlags m_connectionFlags;                  //! Connection flags (for preparing relevant statements)
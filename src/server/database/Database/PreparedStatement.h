@@ -174,6 +174,7 @@ public:
     ~PreparedStatementTask() override;
 
     bool Execute() override;
+    [[nodiscard]] bool IsBatchableWrite() const override { return !m_has_result; }
     PreparedQueryResultFuture GetFuture() { return m_result->get_future(); }
 
 protected:
@@ -21,6 +21,7 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
+#include "QueryResultSnapshot.h"
 
 namespace
 {
@@ -168,7 +169,8 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     _rowCount(rowCount),
     _fieldCount(fieldCount),
     _result(result),
-    _fields(fields)
+    _fields(fields),
+    _snapshotRow(0)
 {
     _fieldMetadata.resize(_fieldCount);
     _currentRow = new Field[_fieldCount];
@@ -180,6 +182,21 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     }
 }
 
+ResultSet::ResultSet(std::shared_ptr<QueryResultSnapshot const> snapshot) :
+    _fieldMetadata(snapshot->_fieldMetadata),
+    _rowCount(snapshot->_rowCount),
+    _fieldCount(snapshot->_fieldCount),
+    _result(nullptr),
+    _fields(nullptr),
+    _snapshot(std::move(snapshot)),
+    _snapshotRow(0)
+{
+    _currentRow = new Field[_fieldCount];
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+        _currentRow[i].SetMetadata(&_fieldMetadata[i]);
+}
+
 ResultSet::~ResultSet()
 {
     CleanUp();
@@ -189,6 +206,26 @@ bool ResultSet::NextRow()
 {
     MYSQL_ROW row;
 
+    if (_snapshot)
+    {
+        if (_snapshotRow >= _rowCount)
+        {
+            CleanUp();
+            return false;
+        }
+
+        std::size_t cell = std::size_t(_snapshotRow++) * _fieldCount;
+        for (uint32 i = 0; i < _fieldCount; i++, cell++)
+        {
+            if (_snapshot->_lengths[cell] == QueryResultSnapshot::NullValue)
+                _currentRow[i].SetStructuredValue(nullptr, 0);
+            else
+                _currentRow[i].SetStructuredValue(&_snapshot->_values[_snapshot->_offsets[cell]], _snapshot->_lengths[cell]);
+        }
+
+        return true;
+    }
+
     if (!_result)
         return false;
 
@@ -216,7 +253,7 @@ bool ResultSet::NextRow()
 std::string ResultSet::GetFieldName(uint32 index) const
 {
     ASSERT(index < _fieldCount);
-    return _fields[index].name;
+    return _fieldMetadata[index].Alias;
 }
 
 void ResultSet::CleanUp()
@@ -232,6 +269,8 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    _snapshot.reset();
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
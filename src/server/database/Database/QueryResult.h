@@ -21,9 +21,12 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Field.h"
+#include <memory>
 #include <tuple>
 #include <vector>
 
+class QueryResultSnapshot;
+
 template<typename T>
 struct ResultIterator
 {
@@ -49,6 +52,7 @@ class AC_DATABASE_API ResultSet
 {
 public:
     ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+    explicit ResultSet(std::shared_ptr<QueryResultSnapshot const> snapshot);
     ~ResultSet();
 
     bool NextRow();
@@ -85,12 +89,17 @@ protected:
     uint32 _fieldCount;
 
 private:
+    friend class QueryResultSnapshot;
+
     void CleanUp();
     void AssertRows(std::size_t sizeRows);
 
     MySQLResult* _result;
     MySQLField* _fields;
 
+    std::shared_ptr<QueryResultSnapshot const> _snapshot;   ///< Rows replayed from a snapshot instead of _result
+    uint64 _snapshotRow;
+
     ResultSet(ResultSet const& right) = delete;
     ResultSet& operator=(ResultSet const& right) = delete;
 };
@@ -0,0 +1,238 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryResultSnapshot.h"
+#include "Log.h"
+#include "QueryResult.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    // bump the last character whenever the layout below changes
+    constexpr char SnapshotMagic[8] = { 'A', 'C', 'Q', 'R', 'S', 'N', 'P', '1' };
+
+    template<class T>
+    void WriteValue(std::ofstream& file, T const& value)
+    {
+        file.write(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    void WriteString(std::ofstream& file, std::string const& value)
+    {
+        WriteValue(file, uint32(value.size()));
+        file.write(value.data(), value.size());
+    }
+
+    template<class T>
+    bool ReadValue(std::ifstream& file, T& value)
+    {
+        return bool(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    bool ReadString(std::ifstream& file, std::string& value)
+    {
+        uint32 size = 0;
+        if (!ReadValue(file, size) || size > 0xFFFF)
+            return false;
+
+        value.resize(size);
+        return bool(file.read(value.data(), size));
+    }
+
+    // bytes left after the read position, sizes read from the file are checked against it before allocating
+    uint64 GetRemainingSize(std::ifstream& file)
+    {
+        std::streampos const position = file.tellg();
+        file.seekg(0, std::ios::end);
+        std::streampos const end = file.tellg();
+        file.seekg(position);
+
+        if (position < 0 || end < position || !file)
+            return 0;
+
+        return uint64(end - position);
+    }
+}
+
+std::shared_ptr<QueryResultSnapshot> QueryResultSnapshot::Create(ResultSet& result)
+{
+    std::shared_ptr<QueryResultSnapshot> snapshot = std::make_shared<QueryResultSnapshot>();
+    snapshot->_fieldCount = result.GetFieldCount();
+    snapshot->_fieldMetadata = result._fieldMetadata;
+    snapshot->_lengths.reserve(result.GetRowCount() * snapshot->_fieldCount);
+
+    do
+    {
+        Field* fields = result.Fetch();
+        if (!fields)
+            break;
+
+        for (uint32 i = 0; i < snapshot->_fieldCount; ++i)
+        {
+            if (fields[i].IsNull())
+            {
+                snapshot->_lengths.push_back(NullValue);
+                continue;
+            }
+
+            std::string_view value = fields[i].Get<std::string_view>();
+            snapshot->_values.insert(snapshot->_values.end(), value.begin(), value.end());
+            snapshot->_values.push_back('\0');
+            snapshot->_lengths.push_back(uint32(value.size()));
+        }
+
+        ++snapshot->_rowCount;
+    } while (result.NextRow());
+
+    snapshot->BuildOffsets();
+    return snapshot;
+}
+
+std::shared_ptr<QueryResultSnapshot> QueryResultSnapshot::LoadFromFile(std::string const& fileName, std::string const& key)
+{
+    std::ifstream file(fileName, std::ios::in | std::ios::binary);
+    if (!file)
+        return nullptr;
+
+    char magic[sizeof(SnapshotMagic)];
+    std::string storedKey;
+    if (!file.read(magic, sizeof(magic)) || memcmp(magic, SnapshotMagic, sizeof(magic)) != 0 || !ReadString(file, storedKey) || storedKey != key)
+        return nullptr;
+
+    std::shared_ptr<QueryResultSnapshot> snapshot = std::make_shared<QueryResultSnapshot>();
+    if (!ReadValue(file, snapshot->_fieldCount) || !ReadValue(file, snapshot->_rowCount))
+        return nullptr;
+
+    // every field stores five string lengths and its type
+    if (uint64(snapshot->_fieldCount) * (5 * sizeof(uint32) + sizeof(uint8)) > GetRemainingSize(file))
+        return nullptr;
+
+    snapshot->_fieldMetadata.resize(snapshot->_fieldCount);
+    for (uint32 i = 0; i < snapshot->_fieldCount; ++i)
+    {
+        QueryResultFieldMetadata& meta = snapshot->_fieldMetadata[i];
+        uint8 type = 0;
+        if (!ReadString(file, meta.TableName) || !ReadString(file, meta.TableAlias) || !ReadString(file, meta.Name) ||
+            !ReadString(file, meta.Alias) || !ReadString(file, meta.TypeName) || !ReadValue(file, type))
+            return nullptr;
+
+        meta.Index = i;
+        meta.Type = DatabaseFieldTypes(type);
+    }
+
+    uint64 valuesSize = 0;
+    if (!ReadValue(file, valuesSize))
+        return nullptr;
+
+    uint64 const valueCount = uint64(snapshot->_rowCount) * snapshot->_fieldCount;
+    uint64 const remainingSize = GetRemainingSize(file);
+    if (valuesSize > remainingSize || valueCount > (remainingSize - valuesSize) / sizeof(uint32))
+        return nullptr;
+
+    snapshot->_values.resize(valuesSize);
+    snapshot->_lengths.resize(valueCount);
+    if (!file.read(snapshot->_values.data(), valuesSize) ||
+        !file.read(reinterpret_cast<char*>(snapshot->_lengths.data()), snapshot->_lengths.size() * sizeof(uint32)))
+        return nullptr;
+
+    // every value has to fit into the buffer with its terminating zero
+    std::size_t used = 0;
+    for (uint32 length : snapshot->_lengths)
+        if (length != NullValue)
+            used += std::size_t(length) + 1;
+
+    if (used != valuesSize)
+        return nullptr;
+
+    snapshot->BuildOffsets();
+    return snapshot;
+}
+
+bool QueryResultSnapshot::WriteToFile(std::string const& fileName, std::string const& key) const
+{
+    // written aside and renamed, a server killed while writing never leaves a damaged snapshot behind
+    std::string const tempFileName = fileName + ".tmp";
+
+    {
+        std::ofstream file(tempFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+
+        file.write(SnapshotMagic, sizeof(SnapshotMagic));
+        WriteString(file, key);
+        WriteValue(file, _fieldCount);
+        WriteValue(file, _rowCount);
+
+        for (QueryResultFieldMetadata const& meta : _fieldMetadata)
+        {
+            WriteString(file, meta.TableName);
+            WriteString(file, meta.TableAlias);
+            WriteString(file, meta.Name);
+            WriteString(file, meta.Alias);
+            WriteString(file, meta.TypeName);
+            WriteValue(file, uint8(meta.Type));
+        }
+
+        WriteValue(file, uint64(_values.size()));
+        file.write(_values.data(), _values.size());
+        file.write(reinterpret_cast<char const*>(_lengths.data()), _lengths.size() * sizeof(uint32));
+
+        if (!file.flush())
+        {
+            file.close();
+            std::remove(tempFileName.c_str());
+            return false;
+        }
+    }
+
+    std::remove(fileName.c_str());
+    if (std::rename(tempFileName.c_str(), fileName.c_str()) != 0)
+    {
+        LOG_ERROR("sql.sql", "QueryResultSnapshot: Could not rename {} to {}", tempFileName, fileName);
+        std::remove(tempFileName.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+QueryResult QueryResultSnapshot::CreateResult() const
+{
+    if (!_rowCount)
+        return QueryResult(nullptr);
+
+    QueryResult result = std::make_shared<ResultSet>(shared_from_this());
+    if (!result->NextRow())
+        return QueryResult(nullptr);
+
+    return result;
+}
+
+void QueryResultSnapshot::BuildOffsets()
+{
+    _offsets.resize(_lengths.size());
+
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < _lengths.size(); ++i)
+    {
+        _offsets[i] = offset;
+        if (_lengths[i] != NullValue)
+            offset += std::size_t(_lengths[i]) + 1;
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _QUERY_RESULT_SNAPSHOT_H
+#define _QUERY_RESULT_SNAPSHOT_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "Field.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+    Rows of a text protocol query result copied into one buffer, so they can be stored on disk
+    and replayed through a regular ResultSet later without asking the database again.
+    Values keep the textual form sent by MySQL, Field conversions work exactly like on a live result.
+*/
+class AC_DATABASE_API QueryResultSnapshot : public std::enable_shared_from_this<QueryResultSnapshot>
+{
+friend class ResultSet;
+
+public:
+    /// Copies the current and all remaining rows of result, leaving it exhausted
+    static std::shared_ptr<QueryResultSnapshot> Create(ResultSet& result);
+
+    /// Returns nullptr if the file is missing, damaged, of another format version or stored with another key
+    static std::shared_ptr<QueryResultSnapshot> LoadFromFile(std::string const& fileName, std::string const& key);
+    bool WriteToFile(std::string const& fileName, std::string const& key) const;
+
+    /// New result over the stored rows, positioned at the first row like DatabaseWorkerPool::Query. nullptr if there are no rows
+    [[nodiscard]] QueryResult CreateResult() const;
+
+    [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
+    [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
+
+private:
+    static constexpr uint32 NullValue = 0xFFFFFFFF;
+
+    void BuildOffsets();
+
+    std::vector<QueryResultFieldMetadata> _fieldMetadata;
+    std::vector<char> _values;              // every value followed by a terminating zero
+    std::vector<uint32> _lengths;           // per cell, row major, NullValue for NULL
+    std::vector<std::size_t> _offsets;      // per cell, into _values
+    uint64 _rowCount = 0;
+    uint32 _fieldCount = 0;
+};
+
+#endif
@@ -53,6 +53,9 @@ public:
     virtual bool Execute() = 0;
     virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
+    /// One-way statement that may be grouped with its neighbours into one implicit transaction
+    [[nodiscard]] virtual bool IsBatchableWrite() const { return false; }
+
     MySQLConnection* m_conn{nullptr};
 
 private:
@@ -133,20 +133,26 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+    if (e == SMART_EVENT_LINK)//special handling
+        return;
+
+    // only visit the events of this type instead of the whole list
+    auto itr = std::lower_bound(mEventsByType.begin(), mEventsByType.end(), uint32(e), [this](uint32 index, uint32 type)
     {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+        return mEvents[index].GetEventType() < type;
+    });
 
-        if (eventType == e)
-        {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent((*i).entryOrGuid, (*i).event_id, (*i).source_type);
-            ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
+    for (; itr != mEventsByType.end(); ++itr)
+    {
+        SmartScriptHolder& holder = mEvents[*itr];
+        if (holder.GetEventType() != uint32(e))
+            break;
 
-            if (sConditionMgr->IsObjectMeetToConditions(info, conds))
-                ProcessEvent(*i, unit, var0, var1, bvar, spell, gob);
-        }
+        ConditionList conds = sConditionMgr->GetConditionsForSmartEvent(holder.entryOrGuid, holder.event_id, holder.source_type);
+        ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
+
+        if (sConditionMgr->IsObjectMeetToConditions(info, conds))
+            ProcessEvent(holder, unit, var0, var1, bvar, spell, gob);
     }
 }
 
@@ -4850,6 +4856,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        UpdateEventsByType();
     }
 }
 
@@ -4863,6 +4870,7 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        UpdateEventsByType();
         mEventSortingRequired = false;
     }
 
@@ -4926,6 +4934,20 @@ void SmartScript::SortEvents(SmartAIEventList& events)
     std::sort(events.begin(), events.end());
 }
 
+void SmartScript::UpdateEventsByType()
+{
+    mEventsByType.clear();
+    mEventsByType.reserve(mEvents.size());
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+        if (mEvents[i].GetEventType() != SMART_EVENT_LINK)
+            mEventsByType.push_back(i);
+
+    std::stable_sort(mEventsByType.begin(), mEventsByType.end(), [this](uint32 left, uint32 right)
+    {
+        return mEvents[left].GetEventType() < mEvents[right].GetEventType();
+    });
+}
+
 void SmartScript::RaisePriority(SmartScriptHolder& e)
 {
     e.timer = 1200;
@@ -4981,6 +5003,8 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger c
         }
         mEvents.push_back((*i));//NOTE: 'world(0)' events still get processed in ANY instance mode
     }
+
+    UpdateEventsByType();
 }
 
 void SmartScript::GetScript()
@@ -660,12 +660,14 @@ void AuctionHouseObject::AddAuction(AuctionEntry *auction)
     ASSERT(auction);
 
     _auctionsMap[auction->Id] = auction;
+    _searchIndex.Insert(auction);
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
 bool AuctionHouseObject::RemoveAuction(AuctionEntry *auction)
 {
     bool wasInMap = !!_auctionsMap.erase(auction->Id);
+    _searchIndex.Remove(auction);
 
     sScriptMgr->OnAuctionRemove(this, auction);
 
@@ -776,10 +778,22 @@ bool AuctionHouseObject::BuildListAuctionItems(WorldPacket &data, Player *player
     {
         auto curTime = GameTime::GetGameTime();
 
-        int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
-        int locdbc_idx = player->GetSession()->GetSessionDbcLocale();
-
-        for (AuctionEntryMap::const_iterator itr = _auctionsMap.begin(); itr != _auctionsMap.end(); ++itr)
+        AuctionSearchFilters filters;
+        filters.InventoryType = inventoryType;
+        filters.ItemClass = itemClass;
+        filters.ItemSubClass = itemSubClass;
+        filters.Quality = quality;
+        filters.LevelMin = levelmin;
+        filters.LevelMax = levelmax;
+        filters.Name = wsearchedname;
+        filters.Locale = player->GetSession()->GetSessionDbLocaleIndex();
+        filters.DbcLocale = player->GetSession()->GetSessionDbcLocale();
+
+        // item filters and name are resolved by the index, only player dependent checks remain here
+        std::vector<AuctionEntry*> candidates;
+        _searchIndex.Search(filters, candidates);
+
+        for (AuctionEntry* Aentry : candidates)
         {
             if ((itrcounter++) % 100 == 0) // check condition every 100 iterations
             {
@@ -789,10 +803,6 @@ bool AuctionHouseObject::BuildListAuctionItems(WorldPacket &data, Player *player
                 }
             }
 
-            AuctionEntry *Aentry = itr->second;
-            if (!Aentry)
-                return false;
-
             // Skip expired auctions
             if (Aentry->expire_time < curTime.count())
             {
@@ -805,38 +815,9 @@ bool AuctionHouseObject::BuildListAuctionItems(WorldPacket &data, Player *player
                 continue;
             }
 
-            ItemTemplate const *proto = item->GetTemplate();
-            if (itemClass != 0xffffffff && proto->Class != itemClass)
-            {
-                continue;
-            }
-
-            if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-            {
-                continue;
-            }
-
-            if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
-            {
-                // xinef: exception, robes are counted as chests
-                if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
-                {
-                    continue;
-                }
-            }
-
-            if (quality != 0xffffffff && proto->Quality < quality)
-            {
-                continue;
-            }
-
-            if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-            {
-                continue;
-            }
-
             if (usable != 0x00)
             {
+                ItemTemplate const *proto = item->GetTemplate();
                 if (player->CanUseItem(item) != EQUIP_ERR_OK)
                 {
                     continue;
@@ -849,63 +830,6 @@ bool AuctionHouseObject::BuildListAuctionItems(WorldPacket &data, Player *player
                 }
             }
 
-            // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
-            // No need to do any of this if no search term was entered
-            if (!wsearchedname.empty())
-            {
-                std::string name = proto->Name1;
-                if (name.empty())
-                {
-                    continue;
-                }
-
-                // local name
-                if (loc_idx >= 0)
-                    if (ItemLocale const *il = sObjectMgr->GetItemLocale(proto->ItemId))
-                        ObjectMgr::GetLocaleString(il->Name, loc_idx, name);
-
-                // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
-                //  that matches the search but it may not equal item->GetItemRandomPropertyId()
-                //  used in BuildAuctionInfo() which then causes wrong items to be listed
-                int32 propRefID = item->GetItemRandomPropertyId();
-
-                if (propRefID)
-                {
-                    // Append the suffix to the name (ie: of the Monkey) if one exists
-                    // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
-                    // even though the DBC name seems misleading
-                    std::array<char const *, 16> const *suffix = nullptr;
-
-                    if (propRefID < 0)
-                    {
-                        ItemRandomSuffixEntry const *itemRandEntry = sItemRandomSuffixStore.LookupEntry(-item->GetItemRandomPropertyId());
-                        if (itemRandEntry)
-                            suffix = &itemRandEntry->Name;
-                    }
-                    else
-                    {
-                        ItemRandomPropertiesEntry const *itemRandEntry = sItemRandomPropertiesStore.LookupEntry(item->GetItemRandomPropertyId());
-                        if (itemRandEntry)
-                            suffix = &itemRandEntry->Name;
-                    }
-
-                    // dbc local name
-                    if (suffix)
-                    {
-                        // Append the suffix (ie: of the Monkey) to the name using localization
-                        // or default enUS if localization is invalid
-                        name += ' ';
-                        name += (*suffix)[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
-                    }
-                }
-
-                // Perform the search (with or without suffix)
-                if (!Utf8FitTo(name, wsearchedname))
-                {
-                    continue;
-                }
-            }
-
             auctionShortlist.push_back(Aentry);
         }
     }
@@ -18,6 +18,7 @@
 #ifndef _AUCTION_HOUSE_MGR_H
 #define _AUCTION_HOUSE_MGR_H
 
+#include "AuctionHouseSearchIndex.h"
 #include "Common.h"
 #include "DBCStructure.h"
 #include "DatabaseEnv.h"
@@ -166,6 +167,7 @@ public:
 
 private:
     AuctionEntryMap _auctionsMap;
+    AuctionHouseSearchIndex _searchIndex;
 
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator _next;
@@ -0,0 +1,342 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionHouseSearchIndex.h"
+#include "AuctionHouseMgr.h"
+#include "DBCStores.h"
+#include "Item.h"
+#include "ObjectMgr.h"
+#include <algorithm>
+
+namespace
+{
+    template<class Key, class Container>
+    void EraseFromBucket(Container& buckets, Key const& key, AuctionEntry* auction)
+    {
+        auto itr = buckets.find(key);
+        if (itr == buckets.end())
+            return;
+
+        itr->second.erase(auction);
+        if (itr->second.empty())
+            buckets.erase(itr);
+    }
+}
+
+void AuctionHouseSearchIndex::Insert(AuctionEntry* auction)
+{
+    IndexedAuction indexed;
+    if (Item* item = sAuctionMgr->GetAItem(auction->item_guid))
+    {
+        indexed.Proto = item->GetTemplate();
+        indexed.RandomPropertyId = item->GetItemRandomPropertyId();
+    }
+    else
+        indexed.Proto = sObjectMgr->GetItemTemplate(auction->item_template);
+
+    if (!indexed.Proto)
+        return;
+
+    ItemTemplate const* proto = indexed.Proto;
+
+    std::unique_lock<std::shared_mutex> guard(_lock);
+
+    auto [itr, inserted] = _auctions.emplace(auction, std::move(indexed));
+    if (!inserted)
+        return;
+
+    _byClass[proto->Class].insert(auction);
+    _bySubClass[(proto->Class << 16) | proto->SubClass].insert(auction);
+    _byInventoryType[proto->InventoryType].insert(auction);
+    if (proto->Quality < MAX_ITEM_QUALITY)
+        _byQuality[proto->Quality].insert(auction);
+    _byRequiredLevel[proto->RequiredLevel].insert(auction);
+
+    for (uint8 nameKey = 0; nameKey < MAX_NAME_KEYS; ++nameKey)
+        if (_names[nameKey].Built)
+            IndexName(auction, itr->second, nameKey);
+}
+
+void AuctionHouseSearchIndex::Remove(AuctionEntry* auction)
+{
+    std::unique_lock<std::shared_mutex> guard(_lock);
+
+    auto itr = _auctions.find(auction);
+    if (itr == _auctions.end())
+        return;
+
+    ItemTemplate const* proto = itr->second.Proto;
+
+    EraseFromBucket(_byClass, proto->Class, auction);
+    EraseFromBucket(_bySubClass, (proto->Class << 16) | proto->SubClass, auction);
+    EraseFromBucket(_byInventoryType, proto->InventoryType, auction);
+    if (proto->Quality < MAX_ITEM_QUALITY)
+        _byQuality[proto->Quality].erase(auction);
+    EraseFromBucket(_byRequiredLevel, proto->RequiredLevel, auction);
+
+    for (uint8 nameKey = 0; nameKey < MAX_NAME_KEYS; ++nameKey)
+        if (_names[nameKey].Built)
+            UnindexName(auction, itr->second, nameKey);
+
+    _auctions.erase(itr);
+}
+
+void AuctionHouseSearchIndex::Search(AuctionSearchFilters const& filters, std::vector<AuctionEntry*>& result)
+{
+    uint8 const nameKey = MakeNameKey(filters.Locale, filters.DbcLocale);
+    if (!filters.Name.empty())
+        EnsureNameIndex(nameKey);
+
+    std::shared_lock<std::shared_mutex> guard(_lock);
+
+    // every source is a union of buckets that contains all matching auctions, scan the smallest one
+    std::vector<CandidateSource> sources;
+
+    if (filters.ItemClass != 0xFFFFFFFF)
+    {
+        CandidateSource& source = sources.emplace_back();
+        if (filters.ItemSubClass != 0xFFFFFFFF)
+        {
+            auto itr = _bySubClass.find((filters.ItemClass << 16) | filters.ItemSubClass);
+            if (itr == _bySubClass.end())
+                return;
+
+            source.push_back(&itr->second);
+        }
+        else
+        {
+            auto itr = _byClass.find(filters.ItemClass);
+            if (itr == _byClass.end())
+                return;
+
+            source.push_back(&itr->second);
+        }
+    }
+
+    if (filters.InventoryType != 0xFFFFFFFF)
+    {
+        CandidateSource& source = sources.emplace_back();
+        auto itr = _byInventoryType.find(filters.InventoryType);
+        if (itr != _byInventoryType.end())
+            source.push_back(&itr->second);
+
+        // xinef: exception, robes are counted as chests
+        if (filters.InventoryType == INVTYPE_CHEST)
+        {
+            itr = _byInventoryType.find(INVTYPE_ROBE);
+            if (itr != _byInventoryType.end())
+                source.push_back(&itr->second);
+        }
+    }
+
+    if (filters.Quality != 0xFFFFFFFF)
+    {
+        CandidateSource& source = sources.emplace_back();
+        for (uint32 quality = filters.Quality; quality < MAX_ITEM_QUALITY; ++quality)
+            source.push_back(&_byQuality[quality]);
+    }
+
+    if (filters.LevelMin != 0x00)
+    {
+        CandidateSource& source = sources.emplace_back();
+        auto end = filters.LevelMax != 0x00 ? _byRequiredLevel.upper_bound(filters.LevelMax) : _byRequiredLevel.end();
+        for (auto itr = _byRequiredLevel.lower_bound(filters.LevelMin); itr != end; ++itr)
+            source.push_back(&itr->second);
+    }
+
+    if (filters.Name.size() >= 3)
+    {
+        // any trigram of the searched name works, take the rarest one
+        NameIndex const& nameIndex = _names[nameKey];
+        AuctionEntrySet const* rarest = nullptr;
+        for (std::size_t i = 0; i + 2 < filters.Name.size(); ++i)
+        {
+            auto itr = nameIndex.Trigrams.find(MakeTrigram(filters.Name[i], filters.Name[i + 1], filters.Name[i + 2]));
+            if (itr == nameIndex.Trigrams.end())
+                return;
+
+            if (!rarest || itr->second.size() < rarest->size())
+                rarest = &itr->second;
+        }
+
+        sources.emplace_back(1, rarest);
+    }
+
+    auto sourceSize = [](CandidateSource const& source)
+    {
+        std::size_t size = 0;
+        for (AuctionEntrySet const* set : source)
+            size += set->size();
+        return size;
+    };
+
+    auto best = std::min_element(sources.begin(), sources.end(), [&sourceSize](CandidateSource const& left, CandidateSource const& right)
+    {
+        return sourceSize(left) < sourceSize(right);
+    });
+
+    auto check = [&](AuctionEntry* auction, IndexedAuction const& indexed)
+    {
+        if (Matches(indexed, filters))
+            result.push_back(auction);
+    };
+
+    if (best == sources.end())
+    {
+        result.reserve(_auctions.size());
+        for (auto const& [auction, indexed] : _auctions)
+            check(auction, indexed);
+    }
+    else
+    {
+        result.reserve(sourceSize(*best));
+        for (AuctionEntrySet const* set : *best)
+            for (AuctionEntry* auction : *set)
+                check(auction, _auctions.at(auction));
+    }
+
+    // keep the order of the auction storage, it is what the client sees when no sort is requested
+    std::sort(result.begin(), result.end(), [](AuctionEntry const* left, AuctionEntry const* right)
+    {
+        return left->Id < right->Id;
+    });
+}
+
+bool AuctionHouseSearchIndex::Matches(IndexedAuction const& indexed, AuctionSearchFilters const& filters) const
+{
+    ItemTemplate const* proto = indexed.Proto;
+
+    if (filters.ItemClass != 0xFFFFFFFF && proto->Class != filters.ItemClass)
+        return false;
+
+    if (filters.ItemSubClass != 0xFFFFFFFF && proto->SubClass != filters.ItemSubClass)
+        return false;
+
+    if (filters.InventoryType != 0xFFFFFFFF && proto->InventoryType != filters.InventoryType)
+    {
+        // xinef: exception, robes are counted as chests
+        if (filters.InventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+            return false;
+    }
+
+    if (filters.Quality != 0xFFFFFFFF && proto->Quality < filters.Quality)
+        return false;
+
+    if (filters.LevelMin != 0x00 && (proto->RequiredLevel < filters.LevelMin || (filters.LevelMax != 0x00 && proto->RequiredLevel > filters.LevelMax)))
+        return false;
+
+    if (!filters.Name.empty())
+    {
+        auto name = indexed.Names.find(MakeNameKey(filters.Locale, filters.DbcLocale));
+        if (name == indexed.Names.end() || name->second.empty() || name->second.find(filters.Name) == std::wstring::npos)
+            return false;
+    }
+
+    return true;
+}
+
+void AuctionHouseSearchIndex::EnsureNameIndex(uint8 nameKey)
+{
+    {
+        std::shared_lock<std::shared_mutex> guard(_lock);
+        if (_names[nameKey].Built)
+            return;
+    }
+
+    std::unique_lock<std::shared_mutex> guard(_lock);
+    if (_names[nameKey].Built)
+        return;
+
+    for (auto& [auction, indexed] : _auctions)
+        IndexName(auction, indexed, nameKey);
+
+    _names[nameKey].Built = true;
+}
+
+void AuctionHouseSearchIndex::IndexName(AuctionEntry* auction, IndexedAuction& indexed, uint8 nameKey)
+{
+    std::wstring& name = indexed.Names[nameKey];
+    name = BuildSearchName(indexed.Proto, indexed.RandomPropertyId, nameKey);
+
+    NameIndex& nameIndex = _names[nameKey];
+    for (std::size_t i = 0; i + 2 < name.size(); ++i)
+        nameIndex.Trigrams[MakeTrigram(name[i], name[i + 1], name[i + 2])].insert(auction);
+}
+
+void AuctionHouseSearchIndex::UnindexName(AuctionEntry* auction, IndexedAuction const& indexed, uint8 nameKey)
+{
+    auto itr = indexed.Names.find(nameKey);
+    if (itr == indexed.Names.end())
+        return;
+
+    std::wstring const& name = itr->second;
+
+    NameIndex& nameIndex = _names[nameKey];
+    for (std::size_t i = 0; i + 2 < name.size(); ++i)
+        EraseFromBucket(nameIndex.Trigrams, MakeTrigram(name[i], name[i + 1], name[i + 2]), auction);
+}
+
+std::wstring AuctionHouseSearchIndex::BuildSearchName(ItemTemplate const* proto, int32 randomPropertyId, uint8 nameKey)
+{
+    LocaleConstant locale = LocaleConstant(nameKey / TOTAL_LOCALES);
+    LocaleConstant dbcLocale = LocaleConstant(nameKey % TOTAL_LOCALES);
+
+    std::string name = proto->Name1;
+    if (name.empty())
+        return {};
+
+    // local name
+    if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+        ObjectMgr::GetLocaleString(il->Name, locale, name);
+
+    // Append the suffix to the name (ie: of the Monkey) if one exists, using the same
+    // random property id as BuildAuctionInfo() so the search matches what is listed
+    if (randomPropertyId)
+    {
+        std::array<char const*, 16> const* suffix = nullptr;
+
+        if (randomPropertyId < 0)
+        {
+            if (ItemRandomSuffixEntry const* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-randomPropertyId))
+                suffix = &itemRandEntry->Name;
+        }
+        else
+        {
+            if (ItemRandomPropertiesEntry const* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(randomPropertyId))
+                suffix = &itemRandEntry->Name;
+        }
+
+        if (suffix)
+        {
+            name += ' ';
+            name += (*suffix)[dbcLocale];
+        }
+    }
+
+    std::wstring wname;
+    if (!Utf8toWStr(name, wname))
+        return {};
+
+    wstrToLower(wname);
+    return wname;
+}
+
+uint64 AuctionHouseSearchIndex::MakeTrigram(wchar_t a, wchar_t b, wchar_t c)
+{
+    // wchar_t holds at most 21 bits of a code point
+    return (uint64(uint32(a) & 0x1FFFFF) << 42) | (uint64(uint32(b) & 0x1FFFFF) << 21) | uint64(uint32(c) & 0x1FFFFF);
+}
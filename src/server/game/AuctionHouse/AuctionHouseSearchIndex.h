@@ -0,0 +1,105 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _AUCTION_HOUSE_SEARCH_INDEX_H
+#define _AUCTION_HOUSE_SEARCH_INDEX_H
+
+#include "Common.h"
+#include "SharedDefines.h"
+#include <array>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct AuctionEntry;
+struct ItemTemplate;
+
+// Item related filters of an auction browse query, 0xFFFFFFFF / 0 mean "any" like in the client packet
+struct AuctionSearchFilters
+{
+    uint32 InventoryType = 0xFFFFFFFF;
+    uint32 ItemClass = 0xFFFFFFFF;
+    uint32 ItemSubClass = 0xFFFFFFFF;
+    uint32 Quality = 0xFFFFFFFF;
+    uint8 LevelMin = 0;
+    uint8 LevelMax = 0;
+    std::wstring Name;          // already lowered
+    LocaleConstant Locale = LOCALE_enUS;        // item name locale
+    LocaleConstant DbcLocale = LOCALE_enUS;     // random property suffix locale
+};
+
+/*
+ * Secondary indexes of an AuctionHouseObject, maintained on AddAuction/RemoveAuction.
+ *
+ * Auctions are indexed by item class, class + subclass, inventory type,
+ * quality and required level. Item names are lowered, suffixed with their
+ * random property name and indexed by trigrams; the name index of a pair of
+ * item name and DBC locales is only built once somebody searches with it.
+ */
+class AuctionHouseSearchIndex
+{
+public:
+    typedef std::unordered_set<AuctionEntry*> AuctionEntrySet;
+
+    void Insert(AuctionEntry* auction);
+    void Remove(AuctionEntry* auction);
+
+    // Returns the auctions matching all item filters, ordered by auction id
+    void Search(AuctionSearchFilters const& filters, std::vector<AuctionEntry*>& result);
+
+private:
+    struct IndexedAuction
+    {
+        ItemTemplate const* Proto = nullptr;
+        int32 RandomPropertyId = 0;
+        std::unordered_map<uint8 /*nameKey*/, std::wstring> Names;
+    };
+
+    struct NameIndex
+    {
+        bool Built = false;
+        std::unordered_map<uint64, AuctionEntrySet> Trigrams;
+    };
+
+    typedef std::vector<AuctionEntrySet const*> CandidateSource;
+
+    void EnsureNameIndex(uint8 nameKey);
+    void IndexName(AuctionEntry* auction, IndexedAuction& indexed, uint8 nameKey);
+    void UnindexName(AuctionEntry* auction, IndexedAuction const& indexed, uint8 nameKey);
+    [[nodiscard]] bool Matches(IndexedAuction const& indexed, AuctionSearchFilters const& filters) const;
+
+    // names are built from the item name locale and the DBC locale of the suffix
+    static constexpr uint8 MAX_NAME_KEYS = TOTAL_LOCALES * TOTAL_LOCALES;
+    static uint8 MakeNameKey(LocaleConstant locale, LocaleConstant dbcLocale) { return uint8(locale * TOTAL_LOCALES + dbcLocale); }
+    static std::wstring BuildSearchName(ItemTemplate const* proto, int32 randomPropertyId, uint8 nameKey);
+    static uint64 MakeTrigram(wchar_t a, wchar_t b, wchar_t c);
+
+    std::shared_mutex _lock;
+
+    std::unordered_map<AuctionEntry*, IndexedAuction> _auctions;
+    std::unordered_map<uint32, AuctionEntrySet> _byClass;
+    std::unordered_map<uint32, AuctionEntrySet> _bySubClass;
+    std::unordered_map<uint32, AuctionEntrySet> _byInventoryType;
+    std::array<AuctionEntrySet, MAX_ITEM_QUALITY> _byQuality;
+    std::map<uint32, AuctionEntrySet> _byRequiredLevel;
+    std::array<NameIndex, MAX_NAME_KEYS> _names;
+};
+
+#endif
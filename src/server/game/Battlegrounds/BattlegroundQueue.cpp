@@ -49,6 +49,7 @@ BattlegroundQueue::BattlegroundQueue()
 
     _queueAnnouncementTimer.fill(-1);
     _queueAnnouncementCrossfactioned = false;
+    m_LastJoinOrder = 0;
 }
 
 BattlegroundQueue::~BattlegroundQueue()
@@ -124,6 +125,26 @@ bool BattlegroundQueue::SelectionPool::AddGroup(GroupQueueInfo* ginfo, uint32 de
     return PlayerCount < desiredCount;
 }
 
+/*********************************************************/
+/***          RATED ARENA QUEUE RATING INDEX           ***/
+/*********************************************************/
+
+void BattlegroundQueue::RatingIndex::AddGroup(GroupQueueInfo* ginfo)
+{
+    _buckets[ginfo->ArenaMatchmakerRating / RATED_ARENA_QUEUE_BUCKET_SIZE].insert(ginfo);
+}
+
+void BattlegroundQueue::RatingIndex::RemoveGroup(GroupQueueInfo* ginfo)
+{
+    auto itr = _buckets.find(ginfo->ArenaMatchmakerRating / RATED_ARENA_QUEUE_BUCKET_SIZE);
+    if (itr == _buckets.end())
+        return;
+
+    itr->second.erase(ginfo);
+    if (itr->second.empty())
+        _buckets.erase(itr);
+}
+
 /*********************************************************/
 /***               BATTLEGROUND QUEUES                 ***/
 /*********************************************************/
@@ -142,6 +163,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     ginfo->IsRated                      = isRated;
     ginfo->IsInvitedToBGInstanceGUID    = 0;
     ginfo->JoinTime                     = GameTime::GetGameTimeMS().count();
+    ginfo->JoinOrder                    = ++m_LastJoinOrder;
     ginfo->RemoveInviteTime             = 0;
     ginfo->teamId                       = leader->GetTeamId();
     ginfo->RealTeamID                   = leader->GetTeamId(true);
@@ -191,6 +213,9 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     //add GroupInfo to m_QueuedGroups
     m_QueuedGroups[bracketId][index].push_back(ginfo);
 
+    if (isRated && index < BG_QUEUE_NORMAL_ALLIANCE)
+        m_RatedQueues[bracketId][index].AddGroup(ginfo);
+
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
 
@@ -336,6 +361,9 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove group queue info no players left
     if (groupInfo->Players.empty())
     {
+        if (groupInfo->IsRated && _groupType < BG_QUEUE_NORMAL_ALLIANCE)
+            m_RatedQueues[_bracketId][_groupType].RemoveGroup(groupInfo);
+
         m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
         delete groupInfo;
         return;
@@ -671,7 +699,7 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
         return false;
 
     //here we have correct 2 selections and we need to change one teams team and move selection pool teams to other team's queue
-    for (GroupsQueueType::iterator itr = m_SelectionPools[otherTeam].SelectedGroups.begin(); itr != m_SelectionPools[otherTeam].SelectedGroups.end(); ++itr)
+    for (auto itr = m_SelectionPools[otherTeam].SelectedGroups.begin(); itr != m_SelectionPools[otherTeam].SelectedGroups.end(); ++itr)
     {
         //set correct team
         (*itr)->teamId = otherTeam;
@@ -864,25 +892,17 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
         int32 discardOpponentsTime = GameTime::GetGameTimeMS().count() - sWorld->getIntConfig(CONFIG_ARENA_PREV_OPPONENTS_DISCARD_TIMER);
 
         // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[PVP_TEAMS_COUNT];
+        GroupQueueInfo* teams[PVP_TEAMS_COUNT] = { };
         uint8 found = 0;
         uint8 team = 0;
 
+        // take the group that joined first
         for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
         {
-            // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
+            if (GroupQueueInfo* ginfo = FindRatedArenaTeam(bracket_id, i, arenaMinRating, arenaMaxRating, discardTime, [](GroupQueueInfo const*) { return true; }))
             {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
+                teams[found++] = ginfo;
+                team = i;
             }
         }
 
@@ -891,24 +911,23 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
 
         if (found == 1)
         {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
+            GroupQueueInfo const* first = teams[0];
+            teams[1] = FindRatedArenaTeam(bracket_id, team, arenaMinRating, arenaMaxRating, discardTime, [first, discardOpponentsTime](GroupQueueInfo const* ginfo)
             {
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating) || (int32)(*itr3)->JoinTime < discardTime)
-                    && ((*(itr_teams[0]))->ArenaTeamId != (*itr3)->PreviousOpponentsTeamId || ((int32)(*itr3)->JoinTime < discardOpponentsTime))
-                    && (*(itr_teams[0]))->ArenaTeamId != (*itr3)->ArenaTeamId)
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
+                return ginfo->JoinOrder > first->JoinOrder
+                    && (first->ArenaTeamId != ginfo->PreviousOpponentsTeamId || ((int32)ginfo->JoinTime < discardOpponentsTime))
+                    && first->ArenaTeamId != ginfo->ArenaTeamId;
+            });
+
+            if (teams[1])
+                ++found;
         }
 
         //if we have 2 teams, then start new arena and invite players!
         if (found == 2)
         {
-            GroupQueueInfo* aTeam = *(itr_teams[TEAM_ALLIANCE]);
-            GroupQueueInfo* hTeam = *(itr_teams[TEAM_HORDE]);
+            GroupQueueInfo* aTeam = teams[TEAM_ALLIANCE];
+            GroupQueueInfo* hTeam = teams[TEAM_HORDE];
 
             Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
             if (!arena)
@@ -930,14 +949,18 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
             {
                 aTeam->GroupType = BG_QUEUE_PREMADE_ALLIANCE;
                 m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
+                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].remove(aTeam);
+                m_RatedQueues[bracket_id][BG_QUEUE_PREMADE_HORDE].RemoveGroup(aTeam);
+                m_RatedQueues[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].AddGroup(aTeam);
             }
 
             if (hTeam->teamId != TEAM_HORDE)
             {
                 hTeam->GroupType = BG_QUEUE_PREMADE_HORDE;
                 m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
+                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].remove(hTeam);
+                m_RatedQueues[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].RemoveGroup(hTeam);
+                m_RatedQueues[bracket_id][BG_QUEUE_PREMADE_HORDE].AddGroup(hTeam);
             }
 
             arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
@@ -951,6 +974,29 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
     }
 }
 
+// first team of a rated arena queue able to play: not invited, accepted by the filter and either
+// within the rating range or waiting long enough to have its rating discarded
+GroupQueueInfo* BattlegroundQueue::FindRatedArenaTeam(BattlegroundBracketId bracket_id, uint8 groupType, uint32 minRating, uint32 maxRating, int32 discardTime, std::function<bool(GroupQueueInfo const*)> const& filter)
+{
+    // teams not yet invited are in join order, so the ones with a discarded rating are at the front
+    for (GroupQueueInfo* ginfo : m_QueuedGroups[bracket_id][groupType])
+    {
+        if (ginfo->IsInvitedToBGInstanceGUID)
+            continue;
+
+        if ((int32)ginfo->JoinTime >= discardTime)
+            break;
+
+        if (filter(ginfo))
+            return ginfo;
+    }
+
+    return m_RatedQueues[bracket_id][groupType].FindFirst(minRating, maxRating, [&filter](GroupQueueInfo const* ginfo)
+    {
+        return !ginfo->IsInvitedToBGInstanceGUID && filter(ginfo);
+    });
+}
+
 void BattlegroundQueue::BattlegroundQueueAnnouncerUpdate(uint32 diff, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundBracketId bracket_id)
 {
     BattlegroundTypeId bgTypeId = BattlegroundMgr::BGTemplateId(bgQueueTypeId);
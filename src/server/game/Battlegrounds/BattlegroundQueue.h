@@ -24,8 +24,13 @@
 #include "EventProcessor.h"
 #include <array>
 #include <deque>
+#include <functional>
+#include <map>
+#include <set>
+#include <vector>
 
 constexpr auto COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME = 10;
+constexpr uint32 RATED_ARENA_QUEUE_BUCKET_SIZE = 50;       // matchmaker rating range of a rated arena queue bucket
 
 struct GroupQueueInfo                                       // stores information about the group in queue (also used when joined as solo!)
 {
@@ -37,6 +42,7 @@ struct GroupQueueInfo                                       // stores informatio
     uint8   ArenaType;                                      // 2v2, 3v3, 5v5 or 0 when BG
     uint32  ArenaTeamId;                                    // team id if rated match
     uint32  JoinTime;                                       // time when group was added
+    uint64  JoinOrder;                                      // increases with every group added to the queue, orders groups joined in the same ms
     uint32  RemoveInviteTime;                               // time when we will remove invite for players in group
     uint32  IsInvitedToBGInstanceGUID;                      // was invited to certain BG
     uint32  ArenaTeamRating;                                // if rated match, inited to the rating of the team
@@ -117,7 +123,7 @@ public:
         bool KickGroup(uint32 size);
         [[nodiscard]] uint32 GetPlayerCount() const { return PlayerCount; }
     public:
-        GroupsQueueType SelectedGroups;
+        std::vector<GroupQueueInfo*> SelectedGroups;        // keeps its storage between queue updates
     private:
         uint32 PlayerCount;
     };
@@ -129,6 +135,51 @@ public:
     [[nodiscard]] int32 GetQueueAnnouncementTimer(uint32 bracketId) const;
 
 private:
+    // rated arena teams of one premade queue, bucketed by matchmaker rating and kept in join order inside a bucket
+    class RatingIndex
+    {
+    public:
+        void AddGroup(GroupQueueInfo* ginfo);
+        void RemoveGroup(GroupQueueInfo* ginfo);
+
+        // first group in join order with a matchmaker rating in [minRating, maxRating] accepted by the filter
+        template<typename Filter>
+        GroupQueueInfo* FindFirst(uint32 minRating, uint32 maxRating, Filter&& filter) const
+        {
+            GroupQueueInfo* first = nullptr;
+            for (auto itr = _buckets.lower_bound(minRating / RATED_ARENA_QUEUE_BUCKET_SIZE); itr != _buckets.end() && itr->first <= maxRating / RATED_ARENA_QUEUE_BUCKET_SIZE; ++itr)
+            {
+                for (GroupQueueInfo* ginfo : itr->second)
+                {
+                    // buckets are in join order, later groups can't beat the best one found so far
+                    if (first && ginfo->JoinOrder > first->JoinOrder)
+                        break;
+
+                    if (ginfo->ArenaMatchmakerRating >= minRating && ginfo->ArenaMatchmakerRating <= maxRating && filter(ginfo))
+                    {
+                        first = ginfo;
+                        break;
+                    }
+                }
+            }
+            return first;
+        }
+
+    private:
+        struct JoinOrderLess
+        {
+            bool operator()(GroupQueueInfo const* left, GroupQueueInfo const* right) const { return left->JoinOrder < right->JoinOrder; }
+        };
+
+        typedef std::set<GroupQueueInfo*, JoinOrderLess> Bucket;
+        std::map<uint32, Bucket> _buckets;
+    };
+
+    GroupQueueInfo* FindRatedArenaTeam(BattlegroundBracketId bracket_id, uint8 groupType, uint32 minRating, uint32 maxRating, int32 discardTime, std::function<bool(GroupQueueInfo const*)> const& filter);
+
+    RatingIndex m_RatedQueues[MAX_BATTLEGROUND_BRACKETS][PVP_TEAMS_COUNT];  // rated teams of BG_QUEUE_PREMADE_ALLIANCE and BG_QUEUE_PREMADE_HORDE
+    uint64 m_LastJoinOrder;
+
     uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
     uint32 m_WaitTimeLastIndex[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
@@ -17,8 +17,8 @@
 
 #include "WhoListCacheMgr.h"
 #include "GuildMgr.h"
-#include "ObjectAccessor.h"
-#include "World.h"
+#include "Player.h"
+#include "WorldSession.h"
 
 WhoListCacheMgr* WhoListCacheMgr::instance()
 {
@@ -26,36 +26,114 @@ WhoListCacheMgr* WhoListCacheMgr::instance()
     return &instance;
 }
 
-void WhoListCacheMgr::Update()
+void WhoListCacheMgr::AddPlayer(Player* player)
 {
-    // clear current list
-    _whoListStorage.clear();
-    _whoListStorage.reserve(sWorld->GetPlayerCount() + 1);
+    std::string const& playerName = player->GetName();
+    std::wstring widePlayerName;
 
-    for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
+    if (!Utf8toWStr(playerName, widePlayerName))
+        return;
+
+    wstrToLower(widePlayerName);
+
+    std::unique_ptr<WhoListPlayerInfo> info = std::make_unique<WhoListPlayerInfo>(player->GetGUID(), player->GetTeamId(),
+        player->getClass(), player->getRace(), player->getGender(), widePlayerName, playerName);
+
+    std::unique_lock<std::shared_mutex> lock(_lock);
+
+    auto itr = _players.find(player->GetGUID());
+    if (itr != _players.end())
     {
-        if (!player->FindMap() || player->GetSession()->PlayerLoading())
-            continue;
+        Unlink(itr->second.get());
+        _players.erase(itr);
+    }
 
-        std::string playerName = player->GetName();
-        std::wstring widePlayerName;
+    Refresh(*info, player);
+    Link(info.get());
+    _players.emplace(player->GetGUID(), std::move(info));
+}
 
-        if (!Utf8toWStr(playerName, widePlayerName))
-            continue;
+void WhoListCacheMgr::RemovePlayer(ObjectGuid guid)
+{
+    std::unique_lock<std::shared_mutex> lock(_lock);
 
-        wstrToLower(widePlayerName);
+    auto itr = _players.find(guid);
+    if (itr == _players.end())
+        return;
+
+    Unlink(itr->second.get());
+    _players.erase(itr);
+}
+
+void WhoListCacheMgr::UpdatePlayer(Player* player)
+{
+    std::unique_lock<std::shared_mutex> lock(_lock);
+
+    auto itr = _players.find(player->GetGUID());
+    if (itr == _players.end())
+        return;
+
+    WhoListPlayerInfo* info = itr->second.get();
+    Unlink(info);
+    Refresh(*info, player);
+    Link(info);
+}
+
+void WhoListCacheMgr::UpdateGuildName(uint32 guildId, std::string const& guildName)
+{
+    std::wstring wideGuildName;
+    if (!Utf8toWStr(guildName, wideGuildName))
+        return;
 
-        std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
-        std::wstring wideGuildName;
+    wstrToLower(wideGuildName);
 
-        if (!Utf8toWStr(guildName, wideGuildName))
+    std::unique_lock<std::shared_mutex> lock(_lock);
+
+    for (auto const& [guid, info] : _players)
+    {
+        if (info->_guildId != guildId)
             continue;
 
-        wstrToLower(wideGuildName);
+        info->_guildName = guildName;
+        info->_wideGuildName = wideGuildName;
+    }
+}
 
-        _whoListStorage.emplace_back(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->GetLevel(),
-            player->getClass(), player->getRace(),
-            (player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId()), player->getGender(), player->IsVisible(),
-            widePlayerName, wideGuildName, playerName, guildName);
+void WhoListCacheMgr::Refresh(WhoListPlayerInfo& info, Player* player)
+{
+    info._security = player->GetSession()->GetSecurity();
+    info._level = player->GetLevel();
+    info._zoneid = player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId();
+    info._visible = player->IsVisible();
+
+    // names only need converting when the guild changes
+    uint32 guildId = player->GetGuildId();
+    if (guildId != info._guildId || (guildId && info._guildName.empty()))
+    {
+        info._guildId = guildId;
+        info._guildName = sGuildMgr->GetGuildNameById(guildId);
+        if (!Utf8toWStr(info._guildName, info._wideGuildName))
+            info._wideGuildName.clear();
+
+        wstrToLower(info._wideGuildName);
     }
 }
+
+void WhoListCacheMgr::Unlink(WhoListPlayerInfo* info)
+{
+    _playersByLevel[info->_level].erase(info);
+
+    auto itr = _playersByZone.find(info->_zoneid);
+    if (itr != _playersByZone.end())
+    {
+        itr->second.erase(info);
+        if (itr->second.empty())
+            _playersByZone.erase(itr);
+    }
+}
+
+void WhoListCacheMgr::Link(WhoListPlayerInfo* info)
+{
+    _playersByLevel[info->_level].insert(info);
+    _playersByZone[info->_zoneid].insert(info);
+}
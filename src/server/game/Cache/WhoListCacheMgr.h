@@ -19,27 +19,33 @@
 #define _WHO_LISTCACHE_H_
 
 #include "Common.h"
+#include "DBCEnums.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <array>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+class Player;
 
 class WhoListPlayerInfo
 {
 public:
-    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, std::wstring const& widePlayerName,
-        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName) :
+    WhoListPlayerInfo(ObjectGuid guid, TeamId team, uint8 clss, uint8 race, uint8 gender, std::wstring const& widePlayerName, std::string const& playerName) :
         _guid(guid),
         _team(team),
-        _security(security),
-        _level(level),
+        _security(SEC_PLAYER),
+        _level(0),
         _class(clss),
         _race(race),
-        _zoneid(zoneid),
+        _zoneid(0),
         _gender(gender),
-        _visible(visible),
+        _visible(true),
+        _guildId(0),
         _widePlayerName(widePlayerName),
-        _wideGuildName(wideGuildName),
-        _playerName(playerName),
-        _guildName(guildName) { }
+        _playerName(playerName) { }
 
     ObjectGuid GetGuid() const { return _guid; }
     TeamId GetTeamId() const { return _team; }
@@ -50,12 +56,15 @@ public:
     uint32 GetZoneId() const { return _zoneid; }
     uint8 GetGender() const { return _gender; }
     bool IsVisible() const { return _visible; }
+    uint32 GetGuildId() const { return _guildId; }
     std::wstring const& GetWidePlayerName() const { return _widePlayerName; }
     std::wstring const& GetWideGuildName() const { return _wideGuildName; }
     std::string const& GetPlayerName() const { return _playerName; }
     std::string const& GetGuildName() const { return _guildName; }
 
 private:
+    friend class WhoListCacheMgr;
+
     ObjectGuid _guid;
     TeamId _team;
     AccountTypes _security;
@@ -65,14 +74,19 @@ private:
     uint32 _zoneid;
     uint8 _gender;
     bool _visible;
+    uint32 _guildId;
     std::wstring _widePlayerName;
     std::wstring _wideGuildName;
     std::string _playerName;
     std::string _guildName;
 };
 
-using WhoListInfoVector = std::vector<WhoListPlayerInfo>;
-
+/*
+ * Online players as seen by /who, kept up to date on login, logout, level,
+ * zone, guild and visibility changes instead of being rebuilt periodically.
+ * Names are stored lowered for matching and players are bucketed by level and
+ * zone so a query only visits players that can match its level range or zones.
+ */
 class AC_GAME_API WhoListCacheMgr
 {
     WhoListCacheMgr() = default;
@@ -86,11 +100,54 @@ class AC_GAME_API WhoListCacheMgr
 public:
     static WhoListCacheMgr* instance();
 
-    void Update();
-    WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
+    void AddPlayer(Player* player);
+    void RemovePlayer(ObjectGuid guid);
+    // Refreshes the level, zone, guild, visibility and security of a listed player
+    void UpdatePlayer(Player* player);
+    void UpdateGuildName(uint32 guildId, std::string const& guildName);
+
+    // Calls visitor for every listed player in one of the zones, or in the level range if no zone is given
+    template<class Visitor>
+    void VisitCandidates(uint32 levelMin, uint32 levelMax, uint32 const* zoneIds, uint32 zoneCount, Visitor&& visitor) const
+    {
+        std::shared_lock<std::shared_mutex> lock(_lock);
+
+        if (zoneCount)
+        {
+            for (uint32 i = 0; i < zoneCount; ++i)
+            {
+                // the client may send a zone twice
+                if (std::find(zoneIds, zoneIds + i, zoneIds[i]) != zoneIds + i)
+                    continue;
+
+                auto itr = _playersByZone.find(zoneIds[i]);
+                if (itr == _playersByZone.end())
+                    continue;
+
+                for (WhoListPlayerInfo const* info : itr->second)
+                    visitor(*info);
+            }
+
+            return;
+        }
+
+        for (uint32 level = levelMin; level <= std::min<uint32>(levelMax, STRONG_MAX_LEVEL); ++level)
+            for (WhoListPlayerInfo const* info : _playersByLevel[level])
+                visitor(*info);
+    }
+
+private:
+    typedef std::unordered_set<WhoListPlayerInfo*> WhoListPlayerSet;
+
+    void Refresh(WhoListPlayerInfo& info, Player* player);
+    void Unlink(WhoListPlayerInfo* info);
+    void Link(WhoListPlayerInfo* info);
+
+    mutable std::shared_mutex _lock;
 
-protected:
-    WhoListInfoVector _whoListStorage;
+    std::unordered_map<ObjectGuid, std::unique_ptr<WhoListPlayerInfo>> _players;
+    std::array<WhoListPlayerSet, STRONG_MAX_LEVEL + 1> _playersByLevel;
+    std::unordered_map<uint32, WhoListPlayerSet> _playersByZone;
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
@@ -23,6 +23,7 @@
 #include "GameTime.h"
 #include "ObjectMgr.h"
 #include "Player.h"
+#include "ScriptMgr.h"
 #include "SocialMgr.h"
 #include "World.h"
 
@@ -36,7 +37,8 @@ Channel::Channel(std::string const& name, uint32 channelId, uint32 channelDBId,
     _channelDBId(channelDBId),
     _teamId(teamId),
     _name(name),
-    _password("")
+    _password(""),
+    _pendingBroadcasts(std::make_shared<std::atomic<uint32>>(0))
 {
     // set special flags if built-in channel
     if (ChatChannelsEntry const* ch = sChatChannelsStore.LookupEntry(channelId)) // check whether it's a built-in channel
@@ -211,6 +213,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.plrPtr = player;
 
     playersStore[guid] = pinfo;
+    _broadcastRecipients.reset();
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->GetSession()).PSendSysMessage("{}", _channelRights.joinMessage);
@@ -275,6 +278,7 @@ void Channel::LeaveChannel(Player* player, bool send)
     bool changeowner = playersStore[guid].IsOwner();
 
     playersStore.erase(guid);
+    _broadcastRecipients.reset();
     if (_announce && ShouldAnnouncePlayer(player))
     {
         WorldPacket data;
@@ -442,6 +446,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
     if (isOnChannel)
     {
         playersStore.erase(victim);
+        _broadcastRecipients.reset();
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -909,9 +914,53 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->GetSession()->SendPacket(data);
+    SharedWorldPacketPtr sharedData = std::make_shared<SharedWorldPacket>(*data);
+    GuidUnorderedSet const* ignorers = guid ? sSocialMgr->GetIgnorers(guid) : nullptr;
+
+    // large channels hand the fan-out over to the broadcast worker, and keep doing so
+    // while some of their messages are queued so these cannot be overtaken
+    uint32 asyncThreshold = sWorld->getIntConfig(CONFIG_CHANNEL_BROADCAST_THRESHOLD);
+    if ((asyncThreshold && playersStore.size() >= asyncThreshold) || *_pendingBroadcasts)
+    {
+        ChannelBroadcast broadcast;
+        broadcast.ChannelName = _name;
+        broadcast.Packet = sharedData;
+        broadcast.Recipients = GetBroadcastRecipients(data);
+        broadcast.Pending = _pendingBroadcasts;
+
+        if (ignorers)
+            broadcast.Ignorers = *ignorers;
+
+        if (ChannelBroadcastMgr::Enqueue(std::move(broadcast)))
+            return;
+    }
+
+    for (auto const& [memberGuid, pinfo] : playersStore)
+        if (!ignorers || !ignorers->count(memberGuid))
+            pinfo.plrPtr->GetSession()->SendSharedPacket(sharedData);
+}
+
+std::shared_ptr<ChannelBroadcast::RecipientList const> Channel::GetBroadcastRecipients(WorldPacket const* data)
+{
+    // packet send hooks may drop any single recipient, such a snapshot is only good for one packet
+    bool filtered = sScriptMgr->HasPacketSendHooks();
+    if (_broadcastRecipients && !filtered)
+        return _broadcastRecipients;
+
+    auto recipients = std::make_shared<ChannelBroadcast::RecipientList>();
+    recipients->reserve(playersStore.size());
+
+    for (auto const& [memberGuid, pinfo] : playersStore)
+    {
+        WorldSession* session = pinfo.plrPtr->GetSession();
+        if (session->GetSocket() && (!filtered || sScriptMgr->CanPacketSend(session, *data)))
+            recipients->emplace_back(memberGuid, session->GetSocket());
+    }
+
+    if (!filtered)
+        _broadcastRecipients = recipients;
+
+    return recipients;
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
@@ -18,6 +18,7 @@
 #ifndef _CHANNEL_H
 #define _CHANNEL_H
 
+#include "ChannelBroadcastMgr.h"
 #include "Common.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -270,6 +271,7 @@ private:
     void SendToAllButOne(WorldPacket* data, ObjectGuid who);
     void SendToOne(WorldPacket* data, ObjectGuid who);
     void SendToAllWatching(WorldPacket* data);
+    std::shared_ptr<ChannelBroadcast::RecipientList const> GetBroadcastRecipients(WorldPacket const* data);
 
     bool ShouldAnnouncePlayer(Player const* player) const;
 
@@ -337,5 +339,7 @@ private:
     PlayerContainer playersStore;
     BannedContainer bannedStore;
     PlayersWatchingContainer playersWatchingStore;
+    std::shared_ptr<ChannelBroadcast::RecipientList const> _broadcastRecipients; // reset whenever playersStore changes
+    std::shared_ptr<std::atomic<uint32>> _pendingBroadcasts;                     // messages waiting for the broadcast worker
 };
 #endif
@@ -0,0 +1,122 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ChannelBroadcastMgr.h"
+#include "Log.h"
+#include "Metric.h"
+#include "WorldSocket.h"
+
+std::thread ChannelBroadcastMgr::workerThread;
+bool ChannelBroadcastMgr::running = false;
+std::size_t ChannelBroadcastMgr::maxQueuedBroadcasts = 0;
+std::mutex ChannelBroadcastMgr::queueLock;
+std::condition_variable ChannelBroadcastMgr::queueCondition;
+std::deque<ChannelBroadcast> ChannelBroadcastMgr::queuedBroadcasts;
+
+void ChannelBroadcastMgr::Initialize(std::size_t maxQueueSize)
+{
+    LOG_INFO("server", "Starting up Channel Broadcast service...");
+
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+        running = true;
+        maxQueuedBroadcasts = maxQueueSize;
+    }
+
+    workerThread = std::thread(&ChannelBroadcastMgr::WorkerThread);
+}
+
+void ChannelBroadcastMgr::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+        running = false;
+    }
+
+    queueCondition.notify_all();
+
+    if (workerThread.joinable())
+        workerThread.join();
+
+    queuedBroadcasts.clear();
+
+    LOG_INFO("server", "Channel Broadcast service exiting without problems.");
+}
+
+bool ChannelBroadcastMgr::Enqueue(ChannelBroadcast&& broadcast)
+{
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+
+        if (!running)
+            return false;
+
+        // the limit is soft for channels with queued messages, sending directly would overtake them
+        if (maxQueuedBroadcasts && queuedBroadcasts.size() >= maxQueuedBroadcasts && !*broadcast.Pending)
+        {
+            LOG_DEBUG("chat.system", "ChannelBroadcastMgr: queue is full, channel {} sends its message directly", broadcast.ChannelName);
+            return false;
+        }
+
+        ++*broadcast.Pending;
+        broadcast.QueuedTime = std::chrono::steady_clock::now();
+        queuedBroadcasts.push_back(std::move(broadcast));
+    }
+
+    queueCondition.notify_one();
+    return true;
+}
+
+std::size_t ChannelBroadcastMgr::GetQueueSize()
+{
+    std::lock_guard<std::mutex> guard(queueLock);
+    return queuedBroadcasts.size();
+}
+
+void ChannelBroadcastMgr::WorkerThread()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> guard(queueLock);
+
+        queueCondition.wait(guard, [] { return !running || !queuedBroadcasts.empty(); });
+
+        if (!running)
+            return;
+
+        ChannelBroadcast broadcast = std::move(queuedBroadcasts.front());
+        queuedBroadcasts.pop_front();
+
+        guard.unlock();
+
+        std::size_t sent = 0;
+        for (auto const& [guid, socket] : *broadcast.Recipients)
+        {
+            if (!broadcast.Ignorers.empty() && broadcast.Ignorers.count(guid))
+                continue;
+
+            socket->SendPacket(broadcast.Packet);
+            ++sent;
+        }
+
+        --*broadcast.Pending;
+
+        METRIC_VALUE("channel_broadcast_recipients", uint64(sent), METRIC_TAG("channel", broadcast.ChannelName));
+        METRIC_VALUE("channel_broadcast_latency", std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - broadcast.QueuedTime),
+            METRIC_TAG("channel", broadcast.ChannelName));
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ACORE_CHANNELBROADCASTMGR_H
+#define __ACORE_CHANNELBROADCASTMGR_H
+
+#include "Duration.h"
+#include "ObjectGuid.h"
+#include "SharedWorldPacket.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class WorldSocket;
+
+struct ChannelBroadcast
+{
+    typedef std::vector<std::pair<ObjectGuid, std::shared_ptr<WorldSocket>>> RecipientList;
+
+    std::string ChannelName;
+    SharedWorldPacketPtr Packet;
+    std::shared_ptr<RecipientList const> Recipients; // member snapshot of the channel, shared between its messages
+    GuidUnorderedSet Ignorers;              // members ignoring the sender, empty for system messages
+    std::shared_ptr<std::atomic<uint32>> Pending; // messages of the channel still queued, outlives the channel
+    TimePoint QueuedTime;
+};
+
+/*
+ * Channel broadcast fan-out service.
+ *
+ * Large channels hand their messages over to a single worker, which filters
+ * ignoring members and enqueues the shared packet into every member socket.
+ * Channels keep a snapshot of their member sockets until the membership
+ * changes, so nothing here touches Player or WorldSession. One worker keeps
+ * the messages of a channel in order; while a channel has messages queued
+ * its next ones go through the queue too, whatever its size.
+ */
+class ChannelBroadcastMgr
+{
+public:
+    static void Initialize(std::size_t maxQueueSize);
+    static void Shutdown();
+
+    // returns false if the service is not running, or if its queue is full and the channel has no message queued:
+    // the caller must send the message itself. A channel with queued messages may exceed the queue size.
+    static bool Enqueue(ChannelBroadcast&& broadcast);
+    static std::size_t GetQueueSize();
+
+private:
+    static void WorkerThread();
+
+    static std::thread workerThread;
+    static bool running;
+    static std::size_t maxQueuedBroadcasts;
+
+    static std::mutex queueLock;
+    static std::condition_variable queueCondition;
+    static std::deque<ChannelBroadcast> queuedBroadcasts;
+};
+
+#endif
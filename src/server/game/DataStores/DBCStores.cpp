@@ -267,6 +267,8 @@ void LoadDBCStores(const std::string& dataPath)
     StoreProblemList bad_dbc_files;
     uint32 availableDbcLocales = 0xFFFFFFFF;
 
+    DBCStorageBase::SetUseMemoryMapping(sWorld->getBoolConfig(CONFIG_MEMORY_MAPPED_DBC));
+
 #define LOAD_DBC(store, file, dbtable) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable)
 
     LOAD_DBC(sAreaTableStore,                       "AreaTable.dbc",                        "areatable_dbc");
@@ -649,7 +651,8 @@ void LoadDBCStores(const std::string& dataPath)
         exit(1);
     }
 
-    LOG_INFO("server.loading", ">> Initialized {} Data Stores in {} ms", DBCFileCount, GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", ">> Initialized {} Data Stores in {} ms ({} dbc files)", DBCFileCount, GetMSTimeDiffToNow(oldMSTime),
+        sWorld->getBoolConfig(CONFIG_MEMORY_MAPPED_DBC) ? "memory mapped" : "read");
     LOG_INFO("server.loading", " ");
 }
 
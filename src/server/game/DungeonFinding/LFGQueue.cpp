@@ -30,6 +30,69 @@
 
 namespace lfg
 {
+    namespace
+    {
+        // Role compositions reachable after adding a player able to take any of the given roles
+        uint16 AddPlayerRoleStates(uint16 states, uint8 roles)
+        {
+            uint16 result = 0;
+            if (roles & PLAYER_ROLE_TANK)
+                result |= uint16((states & 0x00FF) << 8);      // compositions without a tank
+            if (roles & PLAYER_ROLE_HEALER)
+                result |= uint16((states & 0x0F0F) << 4);      // compositions without a healer
+            if (roles & PLAYER_ROLE_DAMAGE)
+                result |= uint16((states & 0x7777) << 1);      // compositions with less than 3 dps
+            return result;
+        }
+
+        // Role compositions reachable by the union of two disjoint sets of players
+        uint16 MergeRoleStates(uint16 left, uint16 right)
+        {
+            // compositions of left which still have room for the dps count of right
+            static constexpr uint16 dpsRoom[LFG_DPS_NEEDED + 1] = { 0xFFFF, 0x7777, 0x3333, 0x1111 };
+
+            uint16 result = 0;
+            for (uint8 composition = 0; right; ++composition, right >>= 1)
+            {
+                if (!(right & 1))
+                    continue;
+
+                uint16 room = dpsRoom[composition & 3];
+                if (composition & 4)
+                    room &= 0x0F0F;
+                if (composition & 8)
+                    room &= 0x00FF;
+
+                result |= uint16((left & room) << composition);
+            }
+            return result;
+        }
+    }
+
+    LfgMatchData::LfgMatchData(LfgDungeonSet const& dungeonSet, LfgRolesMap const& rolesMap, bool lfgGroup) :
+        players(uint8(rolesMap.size())), lfgGroups(lfgGroup ? 1 : 0)
+    {
+        for (uint32 dungeonId : dungeonSet)
+        {
+            if (dungeonId < LFG_DUNGEON_MASK_SIZE)
+                dungeons.set(dungeonId);
+            else
+                exactDungeons = false;
+        }
+
+        for (auto const& [guid, roles] : rolesMap)
+            roleStates = AddPlayerRoleStates(roleStates, roles);
+    }
+
+    void LfgMatchData::Merge(LfgMatchData const& other)
+    {
+        dungeons &= other.dungeons;
+        roleStates = MergeRoleStates(roleStates, other.roleStates);
+        players += other.players;
+        lfgGroups += other.lfgGroups;
+        exactDungeons = exactDungeons && other.exactDungeons;
+    }
+
     LfgQueueData::LfgQueueData() :
         joinTime(time_t(GameTime::GetGameTime().count())), lastRefreshTime(joinTime), tanks(LFG_TANKS_NEEDED),
         healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED) { }
@@ -107,7 +170,8 @@ namespace lfg
     void LFGQueue::AddQueueData(ObjectGuid guid, time_t joinTime, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
     {
         LOG_DEBUG("lfg", "JOINED AddQueueData: {}", guid.ToString());
-        QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+        LfgQueueData& queueData = QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+        queueData.match = LfgMatchData(dungeons, rolesMap, sLFGMgr->IsLfgGroup(guid));
         AddToQueue(guid);
     }
 
@@ -151,26 +215,26 @@ namespace lfg
     {
         LOG_DEBUG("lfg", "COMPATIBLES REMOVE for: {}", guid.ToString());
         for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
-            if (it->hasGuid(guid))
+            if (it->key.hasGuid(guid))
             {
-                LOG_DEBUG("lfg", "Removed Compatible: {}, because of: {}", it->toString(), guid.ToString());
-                it->clear(); // set to 0, this will be removed while iterating in FindNewGroups
+                LOG_DEBUG("lfg", "Removed Compatible: {}, because of: {}", it->key.toString(), guid.ToString());
+                it->key.clear(); // set to 0, this will be removed while iterating in FindNewGroups
             }
         for (LfgCompatibleContainer::iterator itr = CompatibleTempList.begin(); itr != CompatibleTempList.end(); )
         {
             LfgCompatibleContainer::iterator it = itr++;
-            if (it->hasGuid(guid))
+            if (it->key.hasGuid(guid))
             {
-                LOG_DEBUG("lfg", "Erased Temp Compatible: {}, because of: {}", it->toString(), guid.ToString());
+                LOG_DEBUG("lfg", "Erased Temp Compatible: {}, because of: {}", it->key.toString(), guid.ToString());
                 CompatibleTempList.erase(it);
             }
         }
     }
 
-    void LFGQueue::AddToCompatibles(Lfg5Guids const& key)
+    void LFGQueue::AddToCompatibles(Lfg5Guids const& key, LfgMatchData const& match)
     {
         LOG_DEBUG("lfg", "COMPATIBLES ADD: {}", key.toString());
-        CompatibleTempList.push_back(key);
+        CompatibleTempList.emplace_back(key, match);
     }
 
     uint8 LFGQueue::FindGroups()
@@ -207,34 +271,37 @@ namespace lfg
         // we have to take into account that FindNewGroups is called every X minutes if number of compatibles is low!
         // build set of already present compatibles for this guid
         std::set<Lfg5Guids> currentCompatibles;
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
-            if (it->hasGuid(newGuid))
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
+            if (it->key.hasGuid(newGuid))
             {
                 // unset roles here so they are not copied, restore after insertion
-                LfgRolesMap* r = it->roles;
-                it->roles = nullptr;
-                currentCompatibles.insert(*it);
-                it->roles = r;
+                LfgRolesMap* r = it->key.roles;
+                it->key.roles = nullptr;
+                currentCompatibles.insert(it->key);
+                it->key.roles = r;
             }
 
+        LfgQueueDataContainer::const_iterator itNew = QueueDataStore.find(newGuid);
+        LfgMatchData const* newGuidMatch = itNew != QueueDataStore.end() ? &itNew->second.match : nullptr;
+
         LfgCompatibility selfCompatibility = LFG_COMPATIBILITY_PENDING;
         if (currentCompatibles.empty())
         {
-            selfCompatibility = CheckCompatibility(Lfg5Guids(), newGuid, foundMask, foundCount, currentCompatibles);
+            selfCompatibility = CheckCompatibility(Lfg5Guids(), LfgMatchData(), newGuid, newGuidMatch, foundMask, foundCount, currentCompatibles);
             if (selfCompatibility != LFG_COMPATIBLES_WITH_LESS_PLAYERS) // group is already compatible (a party of 5 players)
                 return selfCompatibility;
         }
 
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
         {
-            Lfg5GuidsList::iterator itr = it++;
-            if (itr->empty())
+            LfgCompatibleContainer::iterator itr = it++;
+            if (itr->key.empty())
             {
                 LOG_DEBUG("lfg", "ERASE from CompatibleList");
                 CompatibleList.erase(itr);
                 continue;
             }
-            LfgCompatibility compatibility = CheckCompatibility(*itr, newGuid, foundMask, foundCount, currentCompatibles);
+            LfgCompatibility compatibility = CheckCompatibility(itr->key, itr->match, newGuid, newGuidMatch, foundMask, foundCount, currentCompatibles);
             if (compatibility == LFG_COMPATIBLES_MATCH)
                 return LFG_COMPATIBLES_MATCH;
             if ((foundMask & 0x3FFF3FFF3FFF3FFF) == 0x3FFF3FFF3FFF3FFF) // each combination of dps+heal+tank already found 4 times
@@ -244,9 +311,32 @@ namespace lfg
         return selfCompatibility;
     }
 
-    LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles)
+    LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, LfgMatchData const& checkWithMatch, const ObjectGuid& newGuid, LfgMatchData const* newGuidMatch, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles)
     {
         LOG_DEBUG("lfg", "CHECK CheckCompatibility: {}, new guid: {}", checkWith.toString(), newGuid.ToString());
+
+        // cheap rejection from the merged masks, the checks below reach the same verdict for these
+        LfgMatchData match = checkWithMatch;
+        if (newGuidMatch)
+        {
+            match.Merge(*newGuidMatch);
+
+            if (match.lfgGroups > 1)
+                return LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS;
+
+            if (match.players > MAXGROUPSIZE)
+                return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
+
+            if (!checkWith.empty())
+            {
+                if (!match.roleStates)
+                    return LFG_INCOMPATIBLES_NO_ROLES;
+
+                if (match.exactDungeons && match.dungeons.none())
+                    return LFG_INCOMPATIBLES_NO_DUNGEONS;
+            }
+        }
+
         Lfg5Guids check(checkWith, false); // here newGuid is at front
         Lfg5Guids strGuids(checkWith, false); // here guids are sorted
         check.force_insert_front(newGuid);
@@ -302,7 +392,7 @@ namespace lfg
             strGuids.addRoles(roles);
             itQueue->second.bestCompatible.clear(); // this may be left after a failed proposal (not cleared, because UpdateQueueTimers would try to generate it with every update)
             //UpdateBestCompatibleInQueue(itQueue, strGuids);
-            AddToCompatibles(strGuids);
+            AddToCompatibles(strGuids, match);
             if (roleCheckResult && roleCheckResult <= 15)
                 foundMask |= ( (((uint64)1) << (roleCheckResult - 1)) | (((uint64)1) << (16 + roleCheckResult - 1)) | (((uint64)1) << (32 + roleCheckResult - 1)) | (((uint64)1) << (48 + roleCheckResult - 1)) );
             return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
@@ -369,17 +459,21 @@ namespace lfg
             else
                 addToFoundMask |= (((uint64)1) << (roleCheckResult - 1));
 
-            proposalDungeons = QueueDataStore[check.front()].dungeons;
-            for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+            // an exact mask already proved the intersection is not empty, it is built from the mask once a proposal needs it
+            if (!newGuidMatch || !match.exactDungeons)
             {
-                LfgDungeonSet temporal;
-                LfgDungeonSet& dungeons = QueueDataStore[check.guids[i]].dungeons;
-                std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
-                proposalDungeons = temporal;
-            }
+                proposalDungeons = QueueDataStore[check.front()].dungeons;
+                for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+                {
+                    LfgDungeonSet temporal;
+                    LfgDungeonSet& dungeons = QueueDataStore[check.guids[i]].dungeons;
+                    std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
+                    proposalDungeons = temporal;
+                }
 
-            if (proposalDungeons.empty())
-                return LFG_INCOMPATIBLES_NO_DUNGEONS;
+                if (proposalDungeons.empty())
+                    return LFG_INCOMPATIBLES_NO_DUNGEONS;
+            }
         }
         else
         {
@@ -400,7 +494,7 @@ namespace lfg
                 if (!itr->second.bestCompatible.empty()) // update if groups don't have it empty (for empty it will be generated in UpdateQueueTimers)
                     UpdateBestCompatibleInQueue(itr, strGuids);
             }
-            AddToCompatibles(strGuids);
+            AddToCompatibles(strGuids, match);
             foundMask |= addToFoundMask;
             ++foundCount;
             return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
@@ -412,6 +506,11 @@ namespace lfg
         if (!sLFGMgr->AllQueued(check)) // can't create proposal
             return LFG_COMPATIBILITY_PENDING;
 
+        if (proposalDungeons.empty())
+            for (uint32 dungeonId = 0; dungeonId < LFG_DUNGEON_MASK_SIZE; ++dungeonId)
+                if (match.dungeons.test(dungeonId))
+                    proposalDungeons.insert(dungeonId);
+
         // Create a new proposal
         proposal.cancelTime = GameTime::GetGameTime().count() + LFG_TIME_PROPOSAL;
         proposal.state = LFG_PROPOSAL_INITIATING;
@@ -481,10 +580,10 @@ namespace lfg
             m_QueueStatusTimer += diff;
 
         LOG_DEBUG("lfg", "UPDATE UpdateQueueTimers");
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
         {
-            Lfg5GuidsList::iterator itr = it++;
-            if (itr->empty())
+            LfgCompatibleContainer::iterator itr = it++;
+            if (itr->key.empty())
             {
                 LOG_DEBUG("lfg", "UpdateQueueTimers ERASE compatible");
                 CompatibleList.erase(itr);
@@ -576,10 +675,10 @@ namespace lfg
     {
         uint32 numOfCompatibles = 0;
         for (LfgCompatibleContainer::const_iterator itr = CompatibleList.begin(); itr != CompatibleList.end(); ++itr)
-            if (itr->hasGuid(itrQueue->first))
+            if (itr->key.hasGuid(itrQueue->first))
             {
                 ++numOfCompatibles;
-                UpdateBestCompatibleInQueue(itrQueue, *itr);
+                UpdateBestCompatibleInQueue(itrQueue, itr->key);
             }
         return numOfCompatibles;
     }
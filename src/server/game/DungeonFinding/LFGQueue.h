@@ -18,6 +18,7 @@
 #ifndef _LFGQUEUE_H
 #define _LFGQUEUE_H
 
+#include <bitset>
 #include <utility>
 
 #include "LFG.h"
@@ -37,6 +38,30 @@ namespace lfg
         LFG_COMPATIBLES_MATCH                                  // Must be the last one
     };
 
+    // Dungeon ids covered by LfgDungeonMask, LFGDungeons.dbc stays well below it
+    constexpr uint32 LFG_DUNGEON_MASK_SIZE = 512;
+
+    typedef std::bitset<LFG_DUNGEON_MASK_SIZE> LfgDungeonMask;
+
+    /**
+        Matching data of a queue entry or of a partial group, merged when entries are combined.
+        Lets CheckCompatibility reject combinations without building role maps or dungeon sets.
+    */
+    struct LfgMatchData
+    {
+        LfgMatchData() { dungeons.set(); }
+        LfgMatchData(LfgDungeonSet const& dungeonSet, LfgRolesMap const& rolesMap, bool lfgGroup);
+
+        // Combines two disjoint sets of players, the default constructed value is neutral
+        void Merge(LfgMatchData const& other);
+
+        LfgDungeonMask dungeons;                               // Selected dungeons, one bit per dungeon id
+        uint16 roleStates{1};                                  // Reachable role compositions, bit (8 * tanks + 4 * healers + dps) as in LFGMgr::CheckGroupRoles
+        uint8 players{0};                                      // Number of players
+        uint8 lfgGroups{0};                                    // Number of lfg groups
+        bool exactDungeons{true};                              // False if a dungeon id did not fit in the mask, an empty mask is then not conclusive
+    };
+
     // Stores player or group queue info
     struct LfgQueueData
     {
@@ -55,6 +80,7 @@ namespace lfg
         LfgDungeonSet dungeons;                                // Selected Player/Group Dungeon/s
         LfgRolesMap roles;                                     // Selected Player Role/s
         Lfg5Guids bestCompatible;                              // Best compatible combination of people queued
+        LfgMatchData match;                                    // Dungeons and roles of this entry as used by the matcher
     };
 
     struct LfgWaitTime
@@ -66,7 +92,17 @@ namespace lfg
 
     typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
     typedef std::map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
-    typedef std::list<Lfg5Guids> LfgCompatibleContainer;
+
+    // Partial group found compatible, kept with the matching data of all its members
+    struct LfgCompatible
+    {
+        LfgCompatible(Lfg5Guids const& _key, LfgMatchData const& _match) : key(_key), match(_match) { }
+
+        Lfg5Guids key;
+        LfgMatchData match;
+    };
+
+    typedef std::list<LfgCompatible> LfgCompatibleContainer;
 
     /**
         Stores all data related to queue
@@ -100,13 +136,13 @@ namespace lfg
         void RemoveFromNewQueue(ObjectGuid guid);
 
         void RemoveFromCompatibles(ObjectGuid guid);
-        void AddToCompatibles(Lfg5Guids const& key);
+        void AddToCompatibles(Lfg5Guids const& key, LfgMatchData const& match);
 
         uint32 FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue);
         void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, Lfg5Guids const& key);
 
         LfgCompatibility FindNewGroups(const ObjectGuid& newGuid);
-        LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles);
+        LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, LfgMatchData const& checkWithMatch, const ObjectGuid& newGuid, LfgMatchData const* newGuidMatch, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles);
 
         // Queue
         uint32 m_QueueStatusTimer;                         // used to check interval of sending queue status
@@ -20,6 +20,7 @@
 
 #include "DBCEnums.h"
 #include "DatabaseEnv.h"
+#include "DenseIdStore.h"
 #include "ItemTemplate.h"
 #include "LootMgr.h"
 #include "Unit.h"
@@ -292,7 +293,7 @@ typedef std::vector<uint32> CreatureQuestItemList;
 typedef std::unordered_map<uint32, CreatureQuestItemList> CreatureQuestItemMap;
 
 // Benchmarked: Faster than std::map (insert/find)
-typedef std::unordered_map<uint32, CreatureTemplate> CreatureTemplateContainer;
+typedef DenseIdStore<CreatureTemplate> CreatureTemplateContainer;
 
 // GCC have alternative #pragma pack(N) syntax and old gcc version not support pack(push, N), also any gcc version not support it at some platform
 #if defined(__GNUC__)
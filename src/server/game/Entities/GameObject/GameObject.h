@@ -20,6 +20,7 @@
 
 #include "Common.h"
 #include "DatabaseEnv.h"
+#include "DenseIdStore.h"
 #include "G3D/Quat.h"
 #include "GameObjectData.h"
 #include "LootMgr.h"
@@ -40,7 +41,7 @@ struct TransportAnimation;
 typedef void(*goEventFlag)(Player*, GameObject*, Battleground*);
 
 // Benchmarked: Faster than std::map (insert/find)
-typedef std::unordered_map<uint32, GameObjectTemplate> GameObjectTemplateContainer;
+typedef DenseIdStore<GameObjectTemplate> GameObjectTemplateContainer;
 typedef std::unordered_map<uint32, GameObjectTemplateAddon> GameObjectTemplateAddonContainer;
 
 typedef std::unordered_map<uint32, GameObjectAddon> GameObjectAddonContainer;
@@ -1128,6 +1128,9 @@ void WorldObject::SetVisibilityDistanceOverride(VisibilityDistanceType type)
     }
 
     m_visibilityDistanceOverride = VisibilityDistances[AsUnderlyingType(type)];
+
+    if (IsInWorld())
+        GetMap()->UpdateLargeObjectIndex(this);
 }
 
 void WorldObject::CleanupsBeforeDelete(bool /*finalCleanup*/)
@@ -1177,6 +1180,7 @@ void WorldObject::AddToWorld()
 {
     Object::AddToWorld();
     GetMap()->GetZoneAndAreaId(GetPhaseMask(), _zoneId, _areaId, GetPositionX(), GetPositionY(), GetPositionZ());
+    GetMap()->UpdateLargeObjectIndex(this);
 }
 
 void WorldObject::RemoveFromWorld()
@@ -1185,6 +1189,7 @@ void WorldObject::RemoveFromWorld()
         return;
 
     DestroyForNearbyPlayers();
+    GetMap()->RemoveFromLargeObjectIndex(this);
 
     Object::RemoveFromWorld();
 }
@@ -1327,19 +1332,9 @@ bool WorldObject::IsWithinLOS(float ox, float oy, float oz, VMAP::ModelIgnoreFla
 {
     if (IsInWorld())
     {
-        oz += GetCollisionHeight();
-        float x, y, z;
-        if (GetTypeId() == TYPEID_PLAYER)
-        {
-            GetPosition(x, y, z);
-            z += GetCollisionHeight();
-        }
-        else
-        {
-            GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
-        }
-
-        return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+        G3D::Vector3 from, to;
+        GetLOSPoints(ox, oy, oz, from, to);
+        return GetMap()->isInLineOfSight(from.x, from.y, from.z, to.x, to.y, to.z, GetPhaseMask(), checks, ignoreFlags);
     }
     return true;
 }
@@ -1349,6 +1344,31 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlag
    if (!IsInMap(obj))
         return false;
 
+    G3D::Vector3 from, to;
+    GetLOSPoints(obj, from, to, collisionHeight, combatReach);
+    return GetMap()->isInLineOfSight(from.x, from.y, from.z, to.x, to.y, to.z, GetPhaseMask(), checks, ignoreFlags);
+}
+
+void WorldObject::GetLOSPoints(float ox, float oy, float oz, G3D::Vector3& from, G3D::Vector3& to) const
+{
+    oz += GetCollisionHeight();
+    float x, y, z;
+    if (GetTypeId() == TYPEID_PLAYER)
+    {
+        GetPosition(x, y, z);
+        z += GetCollisionHeight();
+    }
+    else
+    {
+        GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
+    }
+
+    from = G3D::Vector3(x, y, z);
+    to = G3D::Vector3(ox, oy, oz);
+}
+
+void WorldObject::GetLOSPoints(WorldObject const* obj, G3D::Vector3& from, G3D::Vector3& to, Optional<float> collisionHeight /*= { }*/, Optional<float> combatReach /*= { }*/) const
+{
     float ox, oy, oz;
     if (obj->GetTypeId() == TYPEID_PLAYER)
     {
@@ -1367,7 +1387,8 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlag
     else
         GetHitSpherePointFor({ obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight() }, x, y, z, collisionHeight, combatReach);
 
-    return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+    from = G3D::Vector3(x, y, z);
+    to = G3D::Vector3(ox, oy, oz);
 }
 
 void WorldObject::GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z, Optional<float> collisionHeight, Optional<float> combatReach) const
@@ -79,6 +79,7 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "Weather.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -404,6 +405,9 @@ Player::Player(WorldSession* session): Unit(true), m_mover(this)
     m_isInstantFlightOn = true;
 
     _wasOutdoor = true;
+
+    _incrementalVisibilityValid = false;
+    _lastFullVisibilityScanTime = 0;
     sScriptMgr->OnConstructPlayer(this);
 }
 
@@ -2276,6 +2280,14 @@ void Player::SetGameMaster(bool on)
     UpdateObjectVisibility();
 }
 
+void Player::SetInGuild(uint32 GuildId)
+{
+    SetUInt32Value(PLAYER_GUILDID, GuildId);
+    // xinef: update global storage
+    sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
+    sWhoListCacheMgr->UpdatePlayer(this);
+}
+
 void Player::SetGMVisible(bool on)
 {
     const uint32 VISUAL_AURA = 37800;
@@ -2295,6 +2307,8 @@ void Player::SetGMVisible(bool on)
         m_ExtraFlags |= PLAYER_EXTRA_GM_INVISIBLE;
         m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GM, GetSession()->GetSecurity());
     }
+
+    sWhoListCacheMgr->UpdatePlayer(this);
 }
 
 bool Player::IsGroupVisibleFor(Player const* p) const
@@ -15387,6 +15401,8 @@ void Player::SetIsSpectator(bool on)
             }
         }
     }
+
+    sWhoListCacheMgr->UpdatePlayer(this);
 }
 
 bool Player::NeedSendSpectatorData() const
@@ -16261,11 +16277,17 @@ void Player::SetServerSideVisibilityDetect(ServerSideVisibilityType type, Accoun
 void Player::SetFarSightDistance(float radius)
 {
     _farSightDistance = radius;
+
+    if (IsInWorld())
+        GetMap()->UpdateFarSightPlayer(this);
 }
 
 void Player::ResetFarSightDistance()
 {
     _farSightDistance.reset();
+
+    if (IsInWorld())
+        GetMap()->UpdateFarSightPlayer(this);
 }
 
 Optional<float> Player::GetFarSightDistance() const
@@ -1868,12 +1868,7 @@ public:
     void RemoveFromGroup(RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT) { RemoveFromGroup(GetGroup(), GetGUID(), method); }
     void SendUpdateToOutOfRangeGroupMembers();
 
-    void SetInGuild(uint32 GuildId)
-    {
-        SetUInt32Value(PLAYER_GUILDID, GuildId);
-        // xinef: update global storage
-        sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
-    }
+    void SetInGuild(uint32 GuildId);
     void SetRank(uint8 rankId) { SetUInt32Value(PLAYER_GUILDRANK, rankId); }
     [[nodiscard]] uint8 GetRank() const { return uint8(GetUInt32Value(PLAYER_GUILDRANK)); }
     void SetGuildIdInvited(uint32 GuildId) { m_GuildIdInvited = GuildId; }
@@ -2372,6 +2367,10 @@ public:
     void GetInitialVisiblePackets(Unit* target);
     void UpdateObjectVisibility(bool forced = true, bool fromUpdate = false) override;
     void UpdateVisibilityForPlayer(bool mapChange = false);
+
+    // Visibility.Incremental: a relocation may skip the full checks for objects it cannot have changed
+    [[nodiscard]] bool CanUseIncrementalVisibility() const;
+    void SetFullVisibilityScanDone();
     void UpdateVisibilityOf(WorldObject* target);
     void UpdateTriggerVisibility();
 
@@ -2977,6 +2976,11 @@ private:
 
     bool _wasOutdoor;
 
+    // Visibility.Incremental: where and when the last full relocation visibility scan happened
+    bool _incrementalVisibilityValid;
+    Position _lastFullVisibilityScanPos;
+    uint32 _lastFullVisibilityScanTime;
+
     PlayerSettingMap m_charSettingsMap;
 
     Seconds m_creationTime;
@@ -38,6 +38,7 @@
 #include "Vehicle.h"
 #include "Weather.h"
 #include "WeatherMgr.h"
+#include "WhoListCacheMgr.h"
 #include "WorldStatePackets.h"
 
 /// @todo: this import is not necessary for compilation and marked as unused by the IDE
@@ -1222,6 +1223,8 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea)
                                       // just area change, works strange...
         if (Guild* guild = GetGuild())
             guild->UpdateMemberData(this, GUILD_MEMBER_DATA_ZONEID, newZone);
+
+        sWhoListCacheMgr->UpdatePlayer(this);
     }
 
     // group update
@@ -1566,6 +1569,9 @@ void Player::UpdateVisibilityForPlayer(bool mapChange)
 
 void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
 {
+    // anything but plain movement may change what is visible regardless of distance
+    _incrementalVisibilityValid = false;
+
     // Prevent updating visibility if player is not in world (example: LoadFromDB sets drunkstate which updates invisibility while player is not in map)
     if (!IsInWorld())
         return;
@@ -1584,6 +1590,29 @@ void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
     }
 }
 
+bool Player::CanUseIncrementalVisibility() const
+{
+    if (!_incrementalVisibilityValid || !sWorld->getBoolConfig(CONFIG_VISIBILITY_INCREMENTAL))
+        return false;
+
+    // ghosts also see around their corpse, far sight and charms move the viewpoint
+    if (!IsAlive() || GetFarSightDistance() || m_seer != this)
+        return false;
+
+    if (getMSTimeDiff(_lastFullVisibilityScanTime, GameTime::GetGameTimeMS().count()) >= sWorld->getIntConfig(CONFIG_VISIBILITY_INCREMENTAL_FULL_SCAN_INTERVAL))
+        return false;
+
+    // crossed more than a cell since the last full scan, e.g. teleported within the map
+    return GetExactDist2dSq(_lastFullVisibilityScanPos) <= SIZE_OF_GRID_CELL * SIZE_OF_GRID_CELL;
+}
+
+void Player::SetFullVisibilityScanDone()
+{
+    _incrementalVisibilityValid = true;
+    _lastFullVisibilityScanPos.Relocate(GetPositionX(), GetPositionY(), GetPositionZ());
+    _lastFullVisibilityScanTime = GameTime::GetGameTimeMS().count();
+}
+
 template <class T>
 inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, T* target,
                                       std::vector<Unit*>& /*v*/)
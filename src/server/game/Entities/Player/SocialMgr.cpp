@@ -43,6 +43,11 @@ bool PlayerSocial::AddToSocialList(ObjectGuid friendGuid, SocialFlag flag)
     if (GetNumberOfSocialsWithFlag(flag) >= (((flag & SOCIAL_FLAG_FRIEND) != 0) ? SOCIALMGR_FRIEND_LIMIT : SOCIALMGR_IGNORE_LIMIT))
         return false;
 
+    if (flag & SOCIAL_FLAG_FRIEND)
+        sSocialMgr->AddFriendLister(friendGuid, GetPlayerGUID());
+    if (flag & SOCIAL_FLAG_IGNORED)
+        sSocialMgr->AddIgnorer(friendGuid, GetPlayerGUID());
+
     auto itr = m_playerSocialMap.find(friendGuid);
     if (itr != m_playerSocialMap.end())
     {
@@ -79,6 +84,11 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid friendGuid, SocialFlag flag)
 
     itr->second.Flags &= ~flag;
 
+    if (flag & SOCIAL_FLAG_FRIEND)
+        sSocialMgr->RemoveFriendLister(friendGuid, GetPlayerGUID());
+    if (flag & SOCIAL_FLAG_IGNORED)
+        sSocialMgr->RemoveIgnorer(friendGuid, GetPlayerGUID());
+
     if (itr->second.Flags == 0)
     {
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHARACTER_SOCIAL);
@@ -209,6 +219,61 @@ SocialMgr* SocialMgr::instance()
     return &instance;
 }
 
+void SocialMgr::RemovePlayerSocial(ObjectGuid guid)
+{
+    auto itr = m_socialMap.find(guid);
+    if (itr == m_socialMap.end())
+        return;
+
+    for (auto const& [friendGuid, friendInfo] : itr->second.m_playerSocialMap)
+    {
+        if (friendInfo.Flags & SOCIAL_FLAG_FRIEND)
+            RemoveFriendLister(friendGuid, guid);
+        if (friendInfo.Flags & SOCIAL_FLAG_IGNORED)
+            RemoveIgnorer(friendGuid, guid);
+    }
+
+    m_socialMap.erase(itr);
+}
+
+void SocialMgr::AddFriendLister(ObjectGuid friendGuid, ObjectGuid listerGuid)
+{
+    m_friendListerMap[friendGuid].insert(listerGuid);
+}
+
+void SocialMgr::RemoveFriendLister(ObjectGuid friendGuid, ObjectGuid listerGuid)
+{
+    auto itr = m_friendListerMap.find(friendGuid);
+    if (itr == m_friendListerMap.end())
+        return;
+
+    itr->second.erase(listerGuid);
+    if (itr->second.empty())
+        m_friendListerMap.erase(itr);
+}
+
+void SocialMgr::AddIgnorer(ObjectGuid ignoredGuid, ObjectGuid ignorerGuid)
+{
+    m_ignorerMap[ignoredGuid].insert(ignorerGuid);
+}
+
+void SocialMgr::RemoveIgnorer(ObjectGuid ignoredGuid, ObjectGuid ignorerGuid)
+{
+    auto itr = m_ignorerMap.find(ignoredGuid);
+    if (itr == m_ignorerMap.end())
+        return;
+
+    itr->second.erase(ignorerGuid);
+    if (itr->second.empty())
+        m_ignorerMap.erase(itr);
+}
+
+GuidUnorderedSet const* SocialMgr::GetIgnorers(ObjectGuid ignoredGuid) const
+{
+    auto itr = m_ignorerMap.find(ignoredGuid);
+    return itr != m_ignorerMap.end() ? &itr->second : nullptr;
+}
+
 void SocialMgr::GetFriendInfo(Player* player, ObjectGuid friendGUID, FriendInfo& friendInfo)
 {
     if (!player)
@@ -301,18 +366,18 @@ void SocialMgr::BroadcastToFriendListers(Player* player, WorldPacket* packet)
     bool allowTwoSideWhoList = sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_WHO_LIST);
     AccountTypes gmLevelInWhoList = AccountTypes(sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST));
 
-    for (auto const& itr : m_socialMap)
+    auto listers = m_friendListerMap.find(player->GetGUID());
+    if (listers == m_friendListerMap.end())
+        return;
+
+    for (ObjectGuid const& listerGuid : listers->second)
     {
-        auto const& itr2 = itr.second.m_playerSocialMap.find(player->GetGUID());
-        if (itr2 != itr.second.m_playerSocialMap.end() && (itr2->second.Flags & SOCIAL_FLAG_FRIEND))
-        {
-            Player* pFriend = ObjectAccessor::FindPlayer(itr.first);
+        Player* pFriend = ObjectAccessor::FindPlayer(listerGuid);
 
-            // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
-            // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
-            if (pFriend && (!AccountMgr::IsPlayerAccount(pFriend->GetSession()->GetSecurity()) || ((pFriend->GetTeamId() == teamId || allowTwoSideWhoList) && security <= gmLevelInWhoList)) && player->IsVisibleGloballyFor(pFriend))
-                pFriend->GetSession()->SendPacket(packet);
-        }
+        // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
+        // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
+        if (pFriend && (!AccountMgr::IsPlayerAccount(pFriend->GetSession()->GetSecurity()) || ((pFriend->GetTeamId() == teamId || allowTwoSideWhoList) && security <= gmLevelInWhoList)) && player->IsVisibleGloballyFor(pFriend))
+            pFriend->GetSession()->SendPacket(packet);
     }
 }
 
@@ -333,6 +398,11 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid guid)
         auto note = fields[2].Get<std::string>();
 
         social->m_playerSocialMap[friendGuid] = FriendInfo(flags, note);
+
+        if (flags & SOCIAL_FLAG_FRIEND)
+            AddFriendLister(friendGuid, guid);
+        if (flags & SOCIAL_FLAG_IGNORED)
+            AddIgnorer(friendGuid, guid);
     } while (result->NextRow());
 
     return social;
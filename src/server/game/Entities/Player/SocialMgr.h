@@ -21,6 +21,7 @@
 #include "DatabaseEnv.h"
 #include "ObjectGuid.h"
 #include <map>
+#include <unordered_map>
 
 class Player;
 class WorldPacket;
@@ -131,7 +132,7 @@ class SocialMgr
     public:
         static SocialMgr* instance();
         // Misc
-        void RemovePlayerSocial(ObjectGuid guid) { m_socialMap.erase(guid); }
+        void RemovePlayerSocial(ObjectGuid guid);
         static void GetFriendInfo(Player* player, ObjectGuid friendGUID, FriendInfo& friendInfo);
         // Packet management
         void MakeFriendStatusPacket(FriendsResult result, ObjectGuid friend_guid, WorldPacket* data);
@@ -139,9 +140,22 @@ class SocialMgr
         void BroadcastToFriendListers(Player* player, WorldPacket* packet);
         // Loading
         PlayerSocial* LoadFromDB(PreparedQueryResult result, ObjectGuid guid);
+        // Reverse friend index
+        void AddFriendLister(ObjectGuid friendGuid, ObjectGuid listerGuid);
+        void RemoveFriendLister(ObjectGuid friendGuid, ObjectGuid listerGuid);
+        // Reverse ignore index
+        void AddIgnorer(ObjectGuid ignoredGuid, ObjectGuid ignorerGuid);
+        void RemoveIgnorer(ObjectGuid ignoredGuid, ObjectGuid ignorerGuid);
+        GuidUnorderedSet const* GetIgnorers(ObjectGuid ignoredGuid) const;
     private:
         typedef std::map<ObjectGuid, PlayerSocial> SocialMap;
         SocialMap m_socialMap;
+        // friend guid -> loaded players having that guid on their friend list
+        typedef std::unordered_map<ObjectGuid, GuidUnorderedSet> FriendListerMap;
+        FriendListerMap m_friendListerMap;
+        // ignored guid -> loaded players having that guid on their ignore list
+        typedef std::unordered_map<ObjectGuid, GuidUnorderedSet> IgnorerMap;
+        IgnorerMap m_ignorerMap;
 };
 
 #define sSocialMgr SocialMgr::instance()
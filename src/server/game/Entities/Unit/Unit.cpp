@@ -66,6 +66,7 @@
 #include "UpdateFieldFlags.h"
 #include "Util.h"
 #include "Vehicle.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include <math.h>
@@ -418,7 +419,7 @@ void Unit::Update(uint32 p_time)
             {
                 m_delayed_unit_relocation_timer = 0;
                 //ExecuteDelayedUnitRelocationEvent();
-                FindMap()->i_objectsForDelayedVisibility.insert(this);
+                FindMap()->AddObjectToDelayedVisibility(this);
             }
             else
                 m_delayed_unit_relocation_timer -= p_time;
@@ -15414,6 +15415,7 @@ void Unit::SetLevel(uint8 lvl, bool showLevelChange)
     if (GetTypeId() == TYPEID_PLAYER)
     {
         sCharacterCache->UpdateCharacterLevel(GetGUID(), lvl);
+        sWhoListCacheMgr->UpdatePlayer(ToPlayer());
     }
 }
 
@@ -20731,7 +20733,7 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
                 Cell::VisitAllObjects(viewPoint, relocateNoLarge, player->GetSightRange() + VISIBILITY_INC_FOR_GOBJECTS);
                 relocateNoLarge.SendToSelf();
                 Acore::PlayerRelocationNotifier relocateLarge(*player, true);    // visit only large objects; maximum distance
-                Cell::VisitAllObjects(viewPoint, relocateLarge, MAX_VISIBILITY_DISTANCE);
+                viewPoint->GetMap()->VisitLargeObjects(viewPoint, relocateLarge);
                 relocateLarge.SendToSelf();
             }
 
@@ -20764,14 +20766,18 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
             }
         }
 
-        Acore::PlayerRelocationNotifier relocateNoLarge(*player, false); // visit only objects which are not large; default distance
+        bool incremental = player->CanUseIncrementalVisibility();
+        Acore::PlayerRelocationNotifier relocateNoLarge(*player, false, incremental); // visit only objects which are not large; default distance
         Cell::VisitAllObjects(viewPoint, relocateNoLarge, player->GetSightRange() + VISIBILITY_INC_FOR_GOBJECTS);
         relocateNoLarge.SendToSelf();
 
+        if (!incremental && viewPoint == player)
+            player->SetFullVisibilityScanDone();
+
         if (!player->GetFarSightDistance())
         {
             Acore::PlayerRelocationNotifier relocateLarge(*player, true); // visit only large objects; maximum distance
-            Cell::VisitAllObjects(viewPoint, relocateLarge, MAX_VISIBILITY_DISTANCE);
+            viewPoint->GetMap()->VisitLargeObjects(viewPoint, relocateLarge);
             relocateLarge.SendToSelf();
         }
 
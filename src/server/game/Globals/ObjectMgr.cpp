@@ -51,6 +51,7 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "World.h"
+#include "WorldDatabaseSnapshotMgr.h"
 #include <boost/algorithm/string.hpp>
 #include <numeric>
 
@@ -313,9 +314,6 @@ ObjectMgr::ObjectMgr():
 
 ObjectMgr::~ObjectMgr()
 {
-    for (QuestMap::iterator i = _questTemplates.begin(); i != _questTemplates.end(); ++i)
-        delete i->second;
-
     for (PetLevelInfoContainer::iterator i = _petInfoStore.begin(); i != _petInfoStore.end(); ++i)
         delete[] i->second;
 
@@ -517,6 +515,16 @@ void ObjectMgr::LoadPointOfInterestLocales()
     LOG_INFO("server.loading", ">> Loaded {} Points Of Interest Locale Strings in {} ms", (uint32)_pointOfInterestLocaleStore.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
+/// Scripts expect the templates as a vector indexed by entry, with nullptr for unused entries
+static std::vector<CreatureTemplate*> BuildCreatureTemplateIndex(CreatureTemplateContainer& store)
+{
+    std::vector<CreatureTemplate*> index(store.GetIndexSize(), nullptr);
+    for (auto& [entry, creatureTemplate] : store)
+        index[entry] = &creatureTemplate;
+
+    return index;
+}
+
 void ObjectMgr::LoadCreatureTemplates()
 {
     uint32 oldMSTime = getMSTime();
@@ -543,8 +551,7 @@ void ObjectMgr::LoadCreatureTemplates()
         return;
     }
 
-    _creatureTemplateStore.rehash(result->GetRowCount());
-    _creatureTemplateStoreFast.clear();
+    _creatureTemplateStore.reserve(result->GetRowCount());
 
     uint32 count = 0;
     do
@@ -557,7 +564,7 @@ void ObjectMgr::LoadCreatureTemplates()
     // We load the creature models after loading but before checking
     LoadCreatureTemplateModels();
 
-    sScriptMgr->OnAfterDatabaseLoadCreatureTemplates(_creatureTemplateStoreFast);
+    sScriptMgr->OnAfterDatabaseLoadCreatureTemplates(BuildCreatureTemplateIndex(_creatureTemplateStore));
 
     LoadCreatureTemplateResistances();
     LoadCreatureTemplateSpells();
@@ -585,15 +592,6 @@ void ObjectMgr::LoadCreatureTemplate(Field* fields, bool triggerHook)
 
     CreatureTemplate& creatureTemplate = _creatureTemplateStore[entry];
 
-    // enlarge the fast cache as necessary
-    if (_creatureTemplateStoreFast.size() < entry + 1)
-    {
-        _creatureTemplateStoreFast.resize(entry + 1, nullptr);
-    }
-
-    // load a pointer to this creatureTemplate into the fast cache
-    _creatureTemplateStoreFast[entry] = &creatureTemplate;
-
     // build the creatureTemplate
     creatureTemplate.Entry = entry;
 
@@ -700,7 +698,7 @@ void ObjectMgr::LoadCreatureTemplate(Field* fields, bool triggerHook)
     // useful if the creature template load is being triggered from outside this class
     if (triggerHook)
     {
-        sScriptMgr->OnAfterDatabaseLoadCreatureTemplates(_creatureTemplateStoreFast);
+        sScriptMgr->OnAfterDatabaseLoadCreatureTemplates(BuildCreatureTemplateIndex(_creatureTemplateStore));
     }
 
 }
@@ -786,15 +784,14 @@ void ObjectMgr::LoadCreatureTemplateResistances()
             continue;
         }
 
-        CreatureTemplateContainer::iterator itr = _creatureTemplateStore.find(creatureID);
-        if (itr == _creatureTemplateStore.end())
+        CreatureTemplate* creatureTemplate = _creatureTemplateStore.Find(creatureID);
+        if (!creatureTemplate)
         {
             LOG_ERROR("sql.sql", "creature_template_resistance has resistance definitions for creature {} but this creature doesn't exist", creatureID);
             continue;
         }
 
-        CreatureTemplate& creatureTemplate = itr->second;
-        creatureTemplate.resistance[school] = fields[2].Get<int16>();
+        creatureTemplate->resistance[school] = fields[2].Get<int16>();
 
         ++count;
     } while (result->NextRow());
@@ -832,15 +829,14 @@ void ObjectMgr::LoadCreatureTemplateSpells()
             continue;
         }
 
-        CreatureTemplateContainer::iterator itr = _creatureTemplateStore.find(creatureID);
-        if (itr == _creatureTemplateStore.end())
+        CreatureTemplate* creatureTemplate = _creatureTemplateStore.Find(creatureID);
+        if (!creatureTemplate)
         {
             LOG_ERROR("sql.sql", "creature_template_spell has spell definitions for creature {} but this creature doesn't exist", creatureID);
             continue;
         }
 
-        CreatureTemplate& creatureTemplate = itr->second;
-        creatureTemplate.spells[index] = fields[2].Get<uint32>();
+        creatureTemplate->spells[index] = fields[2].Get<uint32>();
 
         ++count;
     } while (result->NextRow());
@@ -2107,14 +2103,14 @@ void ObjectMgr::LoadCreatures()
     uint32 oldMSTime = getMSTime();
 
     //                                                     0         1    2    3    4        5            6           7           8            9              10            11
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
+    QueryResult result = sWorldDatabaseSnapshotMgr->Query("creature", "SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
                          //      12            13       14          15           16         17         18          19             20                 21                    22
                          "currentwaypoint, curhealth, curmana, MovementType, spawnMask, phaseMask, eventEntry, pool_entry, creature.npcflag, creature.unit_flags, creature.dynamicflags, "
                          //       23
                          "creature.ScriptName "
                          "FROM creature "
                          "LEFT OUTER JOIN game_event_creature ON creature.guid = game_event_creature.guid "
-                         "LEFT OUTER JOIN pool_creature ON creature.guid = pool_creature.guid");
+                         "LEFT OUTER JOIN pool_creature ON creature.guid = pool_creature.guid", { "creature", "game_event_creature", "pool_creature" });
 
     if (!result)
     {
@@ -2436,13 +2432,13 @@ void ObjectMgr::LoadGameobjects()
     uint32 oldMSTime = getMSTime();
 
     //                                                0                1   2    3           4           5           6
-    QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
+    QueryResult result = sWorldDatabaseSnapshotMgr->Query("gameobject", "SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
                          //   7          8          9          10         11             12            13     14         15         16          17
                          "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnMask, phaseMask, eventEntry, pool_entry, "
                          //   18
                          "ScriptName "
                          "FROM gameobject LEFT OUTER JOIN game_event_gameobject ON gameobject.guid = game_event_gameobject.guid "
-                         "LEFT OUTER JOIN pool_gameobject ON gameobject.guid = pool_gameobject.guid");
+                         "LEFT OUTER JOIN pool_gameobject ON gameobject.guid = pool_gameobject.guid", { "gameobject", "game_event_gameobject", "pool_gameobject" });
 
     if (!result)
     {
@@ -2661,7 +2657,7 @@ void ObjectMgr::LoadItemTemplates()
     uint32 oldMSTime = getMSTime();
 
     //                                                 0      1       2               3              4        5        6       7          8         9        10        11           12
-    QueryResult result = WorldDatabase.Query("SELECT entry, class, subclass, SoundOverrideSubclass, name, displayid, Quality, Flags, FlagsExtra, BuyCount, BuyPrice, SellPrice, InventoryType, "
+    QueryResult result = sWorldDatabaseSnapshotMgr->Query("item_template", "SELECT entry, class, subclass, SoundOverrideSubclass, name, displayid, Quality, Flags, FlagsExtra, BuyCount, BuyPrice, SellPrice, InventoryType, "
                          //                                              13              14           15          16             17               18                19              20
                          "AllowableClass, AllowableRace, ItemLevel, RequiredLevel, RequiredSkill, RequiredSkillRank, requiredspell, requiredhonorrank, "
                          //                                              21                      22                       23               24        25          26             27           28
@@ -2691,7 +2687,7 @@ void ObjectMgr::LoadItemTemplates()
                          //                                            126                 127                     128            129            130            131         132         133
                          "GemProperties, RequiredDisenchantSkill, ArmorDamageModifier, duration, ItemLimitCategory, HolidayId, ScriptName, DisenchantID, "
                          //                                           134        135            136
-                         "FoodType, minMoneyLoot, maxMoneyLoot, flagsCustom FROM item_template");
+                         "FoodType, minMoneyLoot, maxMoneyLoot, flagsCustom FROM item_template", { "item_template" });
 
     if (!result)
     {
@@ -4354,13 +4350,11 @@ void ObjectMgr::LoadQuests()
     uint32 oldMSTime = getMSTime();
 
     // For reload case
-    for (QuestMap::const_iterator itr = _questTemplates.begin(); itr != _questTemplates.end(); ++itr)
-        delete itr->second;
     _questTemplates.clear();
 
     mExclusiveQuestGroups.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT "
+    QueryResult result = sWorldDatabaseSnapshotMgr->Query("quest_template", "SELECT "
                          //0      1         2           3           4           5             6                 7            8
                          "ID, QuestType, QuestLevel, MinLevel, QuestSortID, QuestInfoID, SuggestedGroupNum, TimeAllowed, AllowableRaces,"
                          //      9                     10                   11                    12
@@ -4387,7 +4381,7 @@ void ObjectMgr::LoadQuests()
                          "RequiredItemId1, RequiredItemId2, RequiredItemId3, RequiredItemId4, RequiredItemId5, RequiredItemId6, RequiredItemCount1, RequiredItemCount2, RequiredItemCount3, RequiredItemCount4, RequiredItemCount5, RequiredItemCount6, "
                          //  99           100             101             102             103
                          "Unknown0, ObjectiveText1, ObjectiveText2, ObjectiveText3, ObjectiveText4"
-                         " FROM quest_template");
+                         " FROM quest_template", { "quest_template" });
     if (!result)
     {
         LOG_WARN("server.loading", ">> Loaded 0 quests definitions. DB table `quest_template` is empty.");
@@ -4395,6 +4389,8 @@ void ObjectMgr::LoadQuests()
         return;
     }
 
+    _questTemplates.reserve(result->GetRowCount());
+
     // create multimap previous quest for each existed quest
     // some quests can have many previous maps set by NextQuestId in previous quest
     // for example set of race quests can lead to single not race specific quest
@@ -4402,27 +4398,11 @@ void ObjectMgr::LoadQuests()
     {
         Field* fields = result->Fetch();
 
-        Quest* newQuest = new Quest(fields);
-        _questTemplates[newQuest->GetQuestId()] = newQuest;
+        _questTemplates.Emplace(fields[0].Get<uint32>(), fields);
     } while (result->NextRow());
 
-    // pussywizard:
-    {
-        uint32 max = 0;
-        for (QuestMap::const_iterator itr = _questTemplates.begin(); itr != _questTemplates.end(); ++itr)
-            if (itr->first > max)
-                max = itr->first;
-        if (max)
-        {
-            _questTemplatesFast.clear();
-            _questTemplatesFast.resize(max + 1, nullptr);
-            for (QuestMap::iterator itr = _questTemplates.begin(); itr != _questTemplates.end(); ++itr)
-                _questTemplatesFast[itr->first] = itr->second;
-        }
-    }
-
     for (QuestMap::iterator itr = _questTemplates.begin(); itr != _questTemplates.end(); ++itr)
-        itr->second->InitializeQueryData();
+        itr->second.InitializeQueryData();
 
     std::map<uint32, uint32> usedMailTemplates;
 
@@ -4441,9 +4421,8 @@ void ObjectMgr::LoadQuests()
             Field* fields = result->Fetch();
             uint32 questId = fields[0].Get<uint32>();
 
-            auto itr = _questTemplates.find(questId);
-            if (itr != _questTemplates.end())
-                itr->second->LoadQuestDetails(fields);
+            if (Quest* quest = _questTemplates.Find(questId))
+                quest->LoadQuestDetails(fields);
             else
                 LOG_ERROR("sql.sql", "Table `quest_details` has data for quest {} but such quest does not exist", questId);
         } while (result->NextRow());
@@ -4464,9 +4443,8 @@ void ObjectMgr::LoadQuests()
             Field* fields = result->Fetch();
             uint32 questId = fields[0].Get<uint32>();
 
-            auto itr = _questTemplates.find(questId);
-            if (itr != _questTemplates.end())
-                itr->second->LoadQuestRequestItems(fields);
+            if (Quest* quest = _questTemplates.Find(questId))
+                quest->LoadQuestRequestItems(fields);
             else
                 LOG_ERROR("sql.sql", "Table `quest_request_items` has data for quest {} but such quest does not exist", questId);
         } while (result->NextRow());
@@ -4487,9 +4465,8 @@ void ObjectMgr::LoadQuests()
             Field* fields = result->Fetch();
             uint32 questId = fields[0].Get<uint32>();
 
-            auto itr = _questTemplates.find(questId);
-            if (itr != _questTemplates.end())
-                itr->second->LoadQuestOfferReward(fields);
+            if (Quest* quest = _questTemplates.Find(questId))
+                quest->LoadQuestOfferReward(fields);
             else
                 LOG_ERROR("sql.sql", "Table `quest_offer_reward` has data for quest {} but such quest does not exist", questId);
         } while (result->NextRow());
@@ -4512,9 +4489,8 @@ void ObjectMgr::LoadQuests()
             Field* fields = result->Fetch();
             uint32 questId = fields[0].Get<uint32>();
 
-            auto itr = _questTemplates.find(questId);
-            if (itr != _questTemplates.end())
-                itr->second->LoadQuestTemplateAddon(fields);
+            if (Quest* quest = _questTemplates.Find(questId))
+                quest->LoadQuestTemplateAddon(fields);
             else
                 LOG_ERROR("sql.sql", "Table `quest_template_addon` has data for quest {} but such quest does not exist", questId);
         } while (result->NextRow());
@@ -4527,7 +4503,7 @@ void ObjectMgr::LoadQuests()
         if (DisableMgr::IsDisabledFor(DISABLE_TYPE_QUEST, iter->first, nullptr))
             continue;
 
-        Quest* qinfo = iter->second;
+        Quest* qinfo = &iter->second;
 
         // additional quest integrity checks (GO, creature_template and item_template must be loaded already)
 
@@ -5039,21 +5015,21 @@ void ObjectMgr::LoadQuests()
 
         if (qinfo->RewardNextQuest)
         {
-            QuestMap::iterator qNextItr = _questTemplates.find(qinfo->RewardNextQuest);
-            if (qNextItr == _questTemplates.end())
+            Quest* qNext = _questTemplates.Find(qinfo->RewardNextQuest);
+            if (!qNext)
             {
                 LOG_ERROR("sql.sql", "Quest {} has `RewardNextQuest` = {} but quest {} does not exist, quest chain will not work.",
                                  qinfo->GetQuestId(), qinfo->RewardNextQuest, qinfo->RewardNextQuest);
                 qinfo->RewardNextQuest = 0;
             }
             else
-                qNextItr->second->prevChainQuests.push_back(qinfo->GetQuestId());
+                qNext->prevChainQuests.push_back(qinfo->GetQuestId());
         }
 
         // fill additional data stores
         if (qinfo->PrevQuestId)
         {
-            if (_questTemplates.find(std::abs(qinfo->GetPrevQuestId())) == _questTemplates.end())
+            if (!_questTemplates.Contains(std::abs(qinfo->GetPrevQuestId())))
             {
                 LOG_ERROR("sql.sql", "Quest {} has PrevQuestId {}, but no such quest", qinfo->GetQuestId(), qinfo->GetPrevQuestId());
             }
@@ -5065,13 +5041,13 @@ void ObjectMgr::LoadQuests()
 
         if (qinfo->NextQuestId)
         {
-            QuestMap::iterator qNextItr = _questTemplates.find(qinfo->GetNextQuestId());
-            if (qNextItr == _questTemplates.end())
+            Quest* qNext = _questTemplates.Find(qinfo->GetNextQuestId());
+            if (!qNext)
             {
                 LOG_ERROR("sql.sql", "Quest {} has NextQuestId {}, but no such quest", qinfo->GetQuestId(), qinfo->GetNextQuestId());
             }
             else
-                qNextItr->second->prevQuests.push_back(static_cast<int32>(qinfo->GetQuestId()));
+                qNext->prevQuests.push_back(static_cast<int32>(qinfo->GetQuestId()));
         }
 
         if (qinfo->ExclusiveGroup)
@@ -7114,7 +7090,7 @@ void ObjectMgr::LoadGameObjectTemplate()
         return;
     }
 
-    _gameObjectTemplateStore.rehash(result->GetRowCount());
+    _gameObjectTemplateStore.reserve(result->GetRowCount());
     uint32 count = 0;
     do
     {
@@ -8011,7 +7987,7 @@ void ObjectMgr::LoadQuestRelationsHelper(QuestRelations& map, std::string const&
         uint32 quest  = result->Fetch()[1].Get<uint32>();
         uint32 poolId = result->Fetch()[2].Get<uint32>();
 
-        if (_questTemplates.find(quest) == _questTemplates.end())
+        if (!_questTemplates.Contains(quest))
         {
             LOG_ERROR("sql.sql", "Table `{}`: Quest {} listed for entry {} does not exist.", table, quest, id);
             continue;
@@ -9906,11 +9882,7 @@ void ObjectMgr::LoadFactionChangeTitles()
 
 GameObjectTemplate const* ObjectMgr::GetGameObjectTemplate(uint32 entry)
 {
-    GameObjectTemplateContainer::const_iterator itr = _gameObjectTemplateStore.find(entry);
-    if (itr != _gameObjectTemplateStore.end())
-        return &(itr->second);
-
-    return nullptr;
+    return _gameObjectTemplateStore.Find(entry);
 }
 
 bool ObjectMgr::IsGameObjectStaticTransport(uint32 entry)
@@ -9930,7 +9902,7 @@ GameObjectTemplateAddon const* ObjectMgr::GetGameObjectTemplateAddon(uint32 entr
 
 CreatureTemplate const* ObjectMgr::GetCreatureTemplate(uint32 entry)
 {
-    return entry < _creatureTemplateStoreFast.size() ? _creatureTemplateStoreFast[entry] : nullptr;
+    return _creatureTemplateStore.Find(entry);
 }
 
 VehicleAccessoryList const* ObjectMgr::GetVehicleAccessoryList(Vehicle* veh) const
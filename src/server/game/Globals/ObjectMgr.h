@@ -23,6 +23,7 @@
 #include "Corpse.h"
 #include "Creature.h"
 #include "DatabaseEnv.h"
+#include "DenseIdStore.h"
 #include "DynamicObject.h"
 #include "GameObject.h"
 #include "GossipDef.h"
@@ -502,11 +503,11 @@ typedef std::map<ObjectGuid, ObjectGuid> LinkedRespawnContainer;
 typedef std::unordered_map<ObjectGuid::LowType, CreatureData> CreatureDataContainer;
 typedef std::unordered_map<ObjectGuid::LowType, GameObjectData> GameObjectDataContainer;
 typedef std::map<TempSummonGroupKey, std::vector<TempSummonData> > TempSummonDataContainer;
-typedef std::unordered_map<uint32, CreatureLocale> CreatureLocaleContainer;
-typedef std::unordered_map<uint32, GameObjectLocale> GameObjectLocaleContainer;
-typedef std::unordered_map<uint32, ItemLocale> ItemLocaleContainer;
+typedef DenseIdStore<CreatureLocale> CreatureLocaleContainer;
+typedef DenseIdStore<GameObjectLocale> GameObjectLocaleContainer;
+typedef DenseIdStore<ItemLocale> ItemLocaleContainer;
 typedef std::unordered_map<uint32, ItemSetNameLocale> ItemSetNameLocaleContainer;
-typedef std::unordered_map<uint32, QuestLocale> QuestLocaleContainer;
+typedef DenseIdStore<QuestLocale> QuestLocaleContainer;
 typedef std::unordered_map<uint32, QuestOfferRewardLocale> QuestOfferRewardLocaleContainer;
 typedef std::unordered_map<uint32, QuestRequestItemsLocale> QuestRequestItemsLocaleContainer;
 typedef std::unordered_map<uint32, NpcTextLocale> NpcTextLocaleContainer;
@@ -736,7 +737,7 @@ public:
 
     typedef std::unordered_map<uint32, Item*> ItemMap;
 
-    typedef std::unordered_map<uint32, Quest*> QuestMap;
+    typedef DenseIdStore<Quest> QuestMap;
 
     typedef std::unordered_map<uint32, AreaTrigger> AreaTriggerContainer;
 
@@ -829,7 +830,7 @@ public:
 
     [[nodiscard]] Quest const* GetQuestTemplate(uint32 quest_id) const
     {
-        return quest_id < _questTemplatesFast.size() ? _questTemplatesFast[quest_id] : nullptr;
+        return _questTemplates.Find(quest_id);
     }
 
     [[nodiscard]] QuestMap const& GetQuestTemplates() const { return _questTemplates; }
@@ -1221,21 +1222,15 @@ public:
     }
     [[nodiscard]] CreatureLocale const* GetCreatureLocale(uint32 entry) const
     {
-        CreatureLocaleContainer::const_iterator itr = _creatureLocaleStore.find(entry);
-        if (itr == _creatureLocaleStore.end()) return nullptr;
-        return &itr->second;
+        return _creatureLocaleStore.Find(entry);
     }
     [[nodiscard]] GameObjectLocale const* GetGameObjectLocale(uint32 entry) const
     {
-        GameObjectLocaleContainer::const_iterator itr = _gameObjectLocaleStore.find(entry);
-        if (itr == _gameObjectLocaleStore.end()) return nullptr;
-        return &itr->second;
+        return _gameObjectLocaleStore.Find(entry);
     }
     [[nodiscard]] ItemLocale const* GetItemLocale(uint32 entry) const
     {
-        ItemLocaleContainer::const_iterator itr = _itemLocaleStore.find(entry);
-        if (itr == _itemLocaleStore.end()) return nullptr;
-        return &itr->second;
+        return _itemLocaleStore.Find(entry);
     }
     [[nodiscard]] ItemSetNameLocale const* GetItemSetNameLocale(uint32 entry) const
     {
@@ -1251,9 +1246,7 @@ public:
     }
     [[nodiscard]] QuestLocale const* GetQuestLocale(uint32 entry) const
     {
-        QuestLocaleContainer::const_iterator itr = _questLocaleStore.find(entry);
-        if (itr == _questLocaleStore.end()) return nullptr;
-        return &itr->second;
+        return _questLocaleStore.Find(entry);
     }
     [[nodiscard]] GossipMenuItemsLocale const* GetGossipMenuItemsLocale(uint32 entry) const
     {
@@ -1471,7 +1464,6 @@ private:
     std::map<HighGuid, std::unique_ptr<ObjectGuidGeneratorBase>> _guidGenerators;
 
     QuestMap _questTemplates;
-    std::vector<Quest*> _questTemplatesFast; // pussywizard
 
     typedef std::unordered_map<uint32, GossipText> GossipTextContainer;
     typedef std::unordered_map<uint32, uint32> QuestAreaTriggerContainer;
@@ -1570,7 +1562,6 @@ private:
     CreatureDataContainer _creatureDataStore;
     CreatureTemplateContainer _creatureTemplateStore;
     CreatureCustomIDsContainer _creatureCustomIDsStore;
-    std::vector<CreatureTemplate*> _creatureTemplateStoreFast; // pussywizard
     CreatureModelContainer _creatureModelStore;
     CreatureAddonContainer _creatureAddonStore;
     CreatureAddonContainer _creatureTemplateAddonStore;
@@ -0,0 +1,169 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldDatabaseSnapshotMgr.h"
+#include "Config.h"
+#include "CryptoHash.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "QueryResultSnapshot.h"
+#include "Timer.h"
+#include "Util.h"
+#include "World.h"
+#include <boost/filesystem/operations.hpp>
+
+// part of every key, bump to drop all existing snapshots
+static constexpr char const* WorldDatabaseSnapshotVersion = "1";
+
+WorldDatabaseSnapshotMgr* WorldDatabaseSnapshotMgr::instance()
+{
+    static WorldDatabaseSnapshotMgr instance;
+    return &instance;
+}
+
+void WorldDatabaseSnapshotMgr::Initialize()
+{
+    _enabled = sConfigMgr->GetOption<bool>("WorldDatabaseSnapshots.Enable", false);
+    if (!_enabled)
+        return;
+
+    _directory = sConfigMgr->GetOption<std::string>("WorldDatabaseSnapshots.Directory", "");
+    if (_directory.empty())
+        _directory = sWorld->GetDataPath() + "snapshots";
+
+    if (_directory.back() != '/' && _directory.back() != '\\')
+        _directory.push_back('/');
+
+    boost::system::error_code error;
+    boost::filesystem::create_directories(_directory, error);
+    if (error)
+    {
+        LOG_ERROR("server.loading", "WorldDatabaseSnapshots: Could not create directory {} ({}), snapshots disabled.", _directory, error.message());
+        _enabled = false;
+        return;
+    }
+
+    _checksumTables = sConfigMgr->GetOption<bool>("WorldDatabaseSnapshots.ChecksumTables", false);
+    if (!_checksumTables)
+    {
+        _updatesKey = GetUpdatesKey();
+        if (_updatesKey.empty())
+        {
+            LOG_ERROR("server.loading", "WorldDatabaseSnapshots: No applied update found in the world database, snapshots disabled.");
+            _enabled = false;
+            return;
+        }
+    }
+
+    LOG_INFO("server.loading", "Using world database snapshots in {}", _directory);
+}
+
+QueryResult WorldDatabaseSnapshotMgr::Query(std::string const& name, std::string const& sql, std::initializer_list<std::string> tables)
+{
+    if (!_enabled)
+        return WorldDatabase.Query(sql);
+
+    uint32 oldMSTime = getMSTime();
+
+    std::string key = GetKey(sql, tables);
+    if (key.empty())
+        return WorldDatabase.Query(sql);
+
+    std::string fileName = _directory + name + ".snapshot";
+    if (std::shared_ptr<QueryResultSnapshot> snapshot = QueryResultSnapshot::LoadFromFile(fileName, key))
+    {
+        LOG_INFO("server.loading", ">> Read {} rows of snapshot {} in {} ms", snapshot->GetRowCount(), name, GetMSTimeDiffToNow(oldMSTime));
+        return snapshot->CreateResult();
+    }
+
+    QueryResult result = WorldDatabase.Query(sql);
+    if (!result)
+        return result;
+
+    std::shared_ptr<QueryResultSnapshot> snapshot = QueryResultSnapshot::Create(*result);
+    if (!snapshot->WriteToFile(fileName, key))
+        LOG_ERROR("server.loading", "WorldDatabaseSnapshots: Could not write {}", fileName);
+    else
+        LOG_INFO("server.loading", ">> Stored {} rows in snapshot {}", snapshot->GetRowCount(), name);
+
+    return snapshot->CreateResult();
+}
+
+std::string WorldDatabaseSnapshotMgr::GetKey(std::string const& sql, std::initializer_list<std::string> tables) const
+{
+    if (!_checksumTables)
+    {
+        Acore::Crypto::SHA1 hash;
+        hash.UpdateData(WorldDatabaseSnapshotVersion);
+        hash.UpdateData(sql);
+        hash.UpdateData(_updatesKey);
+        hash.Finalize();
+        return ByteArrayToHexStr(hash.GetDigest());
+    }
+
+    std::string tableList;
+    for (std::string const& table : tables)
+    {
+        if (!tableList.empty())
+            tableList += ", ";
+
+        tableList += "`" + table + "`";
+    }
+
+    QueryResult checksums = WorldDatabase.Query("CHECKSUM TABLE " + tableList);
+    if (!checksums)
+        return "";
+
+    Acore::Crypto::SHA1 hash;
+    hash.UpdateData(WorldDatabaseSnapshotVersion);
+    hash.UpdateData(sql);
+
+    do
+    {
+        Field* fields = checksums->Fetch();
+
+        // NULL checksum: the table does not exist, nothing to key on
+        if (fields[1].IsNull())
+            return "";
+
+        hash.UpdateData(fields[0].Get<std::string>());
+        hash.UpdateData(fields[1].Get<std::string>());
+    } while (checksums->NextRow());
+
+    hash.Finalize();
+    return ByteArrayToHexStr(hash.GetDigest());
+}
+
+std::string WorldDatabaseSnapshotMgr::GetUpdatesKey()
+{
+    // a few thousand short rows, unlike a checksum this does not depend on the size of the snapshot tables
+    QueryResult updates = WorldDatabase.Query("SELECT `name`, `hash` FROM `updates` ORDER BY `name`");
+    if (!updates)
+        return "";
+
+    Acore::Crypto::SHA1 hash;
+
+    do
+    {
+        Field* fields = updates->Fetch();
+        hash.UpdateData(fields[0].Get<std::string>());
+        hash.UpdateData(fields[1].Get<std::string>());
+    } while (updates->NextRow());
+
+    hash.Finalize();
+    return ByteArrayToHexStr(hash.GetDigest());
+}
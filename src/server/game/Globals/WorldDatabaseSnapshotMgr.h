@@ -0,0 +1,63 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLD_DATABASE_SNAPSHOT_MGR_H
+#define _WORLD_DATABASE_SNAPSHOT_MGR_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include <initializer_list>
+#include <string>
+
+/*
+ * On-disk snapshots of the large world database queries run at startup (WorldDatabaseSnapshots.Enable).
+ *
+ * A snapshot stores the rows of one query and is keyed by the query text and
+ * the updates applied to the world database, read once per start from the
+ * `updates` table, so any applied update refreshes it on the next start.
+ * Changes made outside the updater (manual edits, spawns added in game) are
+ * only seen with WorldDatabaseSnapshots.ChecksumTables, which keys on
+ * CHECKSUM TABLE of every table read instead and scans them on each start.
+ * The loaders validate the replayed rows exactly like rows coming from the
+ * database.
+ */
+class AC_GAME_API WorldDatabaseSnapshotMgr
+{
+public:
+    static WorldDatabaseSnapshotMgr* instance();
+
+    void Initialize();
+
+    // Called once the startup loaders are done, later queries (.reload commands) always read the database
+    void FinishStartup() { _enabled = false; }
+
+    // Query of the world database, served from the snapshot called name when it is still current
+    QueryResult Query(std::string const& name, std::string const& sql, std::initializer_list<std::string> tables);
+
+private:
+    std::string GetKey(std::string const& sql, std::initializer_list<std::string> tables) const;
+    static std::string GetUpdatesKey();
+
+    bool _enabled = false;
+    bool _checksumTables = false;
+    std::string _directory;
+    std::string _updatesKey;
+};
+
+#define sWorldDatabaseSnapshotMgr WorldDatabaseSnapshotMgr::instance()
+
+#endif
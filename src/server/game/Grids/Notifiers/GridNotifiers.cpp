@@ -34,7 +34,43 @@ void VisibleNotifier::Visit(GameObjectMapType& m)
             continue;
 
         vis_guids.erase(go->GetGUID());
-        i_player.UpdateVisibilityOf(go, i_data, i_visibleNow);
+        if (!IsVisibilityUnchanged(go))
+            i_player.UpdateVisibilityOf(go, i_data, i_visibleNow);
+    }
+}
+
+bool VisibleNotifier::IsVisibilityUnchanged(WorldObject const* obj) const
+{
+    if (!i_incremental)
+        return false;
+
+    // detecting stealth and invisibility depends on the distance as well
+    if (obj->m_stealth.GetFlags() || obj->m_invisibility.GetFlags())
+        return false;
+
+    // visible and still in range, or not visible and still out of range
+    return i_player.IsWithinDist(obj, i_player.GetSightRange(obj), true) == i_player.HaveAtClient(obj);
+}
+
+void VisibleNotifier::Visit(WorldObject* obj)
+{
+    if (i_largeOnly != obj->IsVisibilityOverridden())
+        return;
+
+    switch (obj->GetTypeId())
+    {
+        case TYPEID_UNIT:
+            if (i_gobjOnly)
+                return;
+            vis_guids.erase(obj->GetGUID());
+            i_player.UpdateVisibilityOf(obj->ToCreature(), i_data, i_visibleNow);
+            break;
+        case TYPEID_GAMEOBJECT:
+            vis_guids.erase(obj->GetGUID());
+            i_player.UpdateVisibilityOf(obj->ToGameObject(), i_data, i_visibleNow);
+            break;
+        default:
+            break;
     }
 }
 
@@ -169,12 +205,15 @@ inline void CreatureUnitRelocationWorker(Creature* c, Unit* u)
 void PlayerRelocationNotifier::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-    {
-        Player* player = iter->GetSource();
-        vis_guids.erase(player->GetGUID());
+        Visit(iter->GetSource());
+}
+
+void PlayerRelocationNotifier::Visit(Player* player)
+{
+    vis_guids.erase(player->GetGUID());
+    if (!IsVisibilityUnchanged(player))
         i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
-        player->UpdateVisibilityOf(&i_player); // this notifier with different Visit(PlayerMapType&) than VisibleNotifier is needed to update visibility of self for other players when we move (eg. stealth detection changes)
-    }
+    player->UpdateVisibilityOf(&i_player); // this notifier with different Visit(PlayerMapType&) than VisibleNotifier is needed to update visibility of self for other players when we move (eg. stealth detection changes)
 }
 
 void CreatureRelocationNotifier::Visit(PlayerMapType& m)
@@ -47,16 +47,21 @@ namespace Acore
         std::vector<Unit*>& i_visibleNow;
         bool i_gobjOnly;
         bool i_largeOnly;
+        bool i_incremental;
         UpdateData i_data;
 
-        VisibleNotifier(Player& player, bool gobjOnly, bool largeOnly) :
-            i_player(player), vis_guids(player.m_clientGUIDs), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly), i_largeOnly(largeOnly)
+        VisibleNotifier(Player& player, bool gobjOnly, bool largeOnly, bool incremental = false) :
+            i_player(player), vis_guids(player.m_clientGUIDs), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly), i_largeOnly(largeOnly), i_incremental(incremental)
         {
             i_visibleNow.clear();
         }
 
+        // Visibility.Incremental: the move cannot have changed whether the player sees obj
+        [[nodiscard]] bool IsVisibilityUnchanged(WorldObject const* obj) const;
+
         void Visit(GameObjectMapType&);
         template<class T> void Visit(GridRefMgr<T>& m);
+        void Visit(WorldObject* obj); // single object looked up outside of the grids, see Map::VisitLargeObjects
         void SendToSelf(void);
     };
 
@@ -73,10 +78,11 @@ namespace Acore
 
     struct PlayerRelocationNotifier : public VisibleNotifier
     {
-        PlayerRelocationNotifier(Player& player, bool largeOnly): VisibleNotifier(player, false, largeOnly) { }
+        PlayerRelocationNotifier(Player& player, bool largeOnly, bool incremental = false): VisibleNotifier(player, false, largeOnly, incremental) { }
 
         template<class T> void Visit(GridRefMgr<T>& m) { VisibleNotifier::Visit(m); }
         void Visit(PlayerMapType&);
+        void Visit(Player* player); // single player looked up outside of the grids, see Map::VisitLargeObjects
     };
 
     struct CreatureRelocationNotifier
@@ -100,6 +106,7 @@ namespace Acore
     {
         WorldObject const* i_source;
         WorldPacket const* i_message;
+        SharedWorldPacketPtr i_sharedMessage;
         uint32 i_phaseMask;
         float i_distSq;
         TeamId teamId;
@@ -125,7 +132,11 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            // copied once and shared by all recipients
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<SharedWorldPacket>(*i_message);
+
+            player->GetSession()->SendSharedPacket(i_sharedMessage);
         }
     };
 
@@ -133,6 +144,7 @@ namespace Acore
     {
         Unit* i_source;
         WorldPacket* i_message;
+        SharedWorldPacketPtr i_sharedMessage;
         uint32 i_phaseMask;
         float i_distSq;
         MessageDistDelivererToHostile(Unit* src, WorldPacket* msg, float dist)
@@ -150,7 +162,11 @@ namespace Acore
             if (player == i_source || !player->HaveAtClient(i_source) || player->IsFriendlyTo(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            // copied once and shared by all recipients
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<SharedWorldPacket>(*i_message);
+
+            player->GetSession()->SendSharedPacket(i_sharedMessage);
         }
     };
 
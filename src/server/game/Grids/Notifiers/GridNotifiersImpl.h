@@ -42,7 +42,8 @@ inline void Acore::VisibleNotifier::Visit(GridRefMgr<T>& m)
             continue;
 
         vis_guids.erase(iter->GetSource()->GetGUID());
-        i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
+        if (!IsVisibilityUnchanged(iter->GetSource()))
+            i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
     }
 }
 
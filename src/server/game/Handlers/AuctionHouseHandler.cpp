@@ -891,9 +891,16 @@ void WorldSession::HandleAuctionListItems(WorldPacket &recvData)
         diff = delay;
     }
     _lastAuctionListItemsMSTime = now + delay - diff;
-    std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetTempLock());
-    AsyncAuctionListingMgr::GetTempList().emplace_back(delay - diff, _player->GetGUID(), guid, searchedname, listfrom, levelmin, levelmax, usable, auctionSlotID,
-                                                       auctionMainCategory, auctionSubCategory, quality, getAll, sortOrder);
+    if (!AsyncAuctionListingMgr::Enqueue(AuctionListItemsDelayEvent(delay - diff, _player->GetGUID(), guid, searchedname, listfrom, levelmin, levelmax, usable, auctionSlotID,
+                                                                    auctionMainCategory, auctionSubCategory, quality, getAll, sortOrder)))
+    {
+        // search queue is full, answer with an empty page so the client does not wait for a result forever
+        WorldPacket data(SMSG_AUCTION_LIST_RESULT, 4 + 4 + 4);
+        data << uint32(0);                                  // count
+        data << uint32(0);                                  // totalcount
+        data << uint32(300);                                // clientside search cooldown [ms] (gray search button)
+        SendPacket(&data);
+    }
 }
 
 void WorldSession::HandleAuctionListPendingSales(WorldPacket &recvData)
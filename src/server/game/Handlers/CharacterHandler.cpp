@@ -55,6 +55,7 @@
 #include "Transport.h"
 #include "UpdateMask.h"
 #include "Util.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -899,6 +900,8 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
 
     m_playerLoading = false;
 
+    sWhoListCacheMgr->AddPlayer(pCurrChar);
+
     // Handle Login-Achievements (should be handled after loading)
     _player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_ON_LOGIN, 1);
 
@@ -2239,10 +2242,10 @@ void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<Charact
             {
                 uint32 newRaceMask = (newTeam == TEAM_ALLIANCE) ? RACEMASK_ALLIANCE : RACEMASK_HORDE;
 
-                if (quest->GetAllowableRaces() && !(quest->GetAllowableRaces() & newRaceMask))
+                if (quest.GetAllowableRaces() && !(quest.GetAllowableRaces() & newRaceMask))
                 {
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE_BY_QUEST);
-                    stmt->SetData(0, quest->GetQuestId());
+                    stmt->SetData(0, quest.GetQuestId());
                     stmt->SetData(1, lowGuid);
                     trans->Append(stmt);
                 }
@@ -2648,6 +2651,7 @@ void WorldSession::HandleFakerLoginFromDB(LoginQueryHolder const& holder)
    if (!pCurrChar->IsStandState() && !pCurrChar->HasUnitState(UNIT_STATE_STUNNED))
        pCurrChar->SetStandState(UNIT_STAND_STATE_STAND);
    m_playerLoading = false;
+   sWhoListCacheMgr->AddPlayer(pCurrChar);
    // Handle Login-Achievements (should be handled after loading)
    _player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_ON_LOGIN, 1);
    // Xinef: fix vendors falling of player vehicle, due to isBeingLoaded checks
@@ -28,6 +28,7 @@
 #include "SpellMgr.h"
 #include "Util.h"
 #include "World.h"
+#include "WorldDatabaseSnapshotMgr.h"
 
 static Rates const qualityToRate[MAX_ITEM_QUALITY] =
 {
@@ -147,7 +148,7 @@ uint32 LootStore::LoadLootTable()
     Clear();
 
     //                                                  0     1            2               3         4         5             6
-    QueryResult result = WorldDatabase.Query("SELECT Entry, Item, Reference, Chance, QuestRequired, LootMode, GroupId, MinCount, MaxCount FROM {}", GetName());
+    QueryResult result = sWorldDatabaseSnapshotMgr->Query(GetName(), Acore::StringFormatFmt("SELECT Entry, Item, Reference, Chance, QuestRequired, LootMode, GroupId, MinCount, MaxCount FROM {}", GetName()), { GetName() });
 
     if (!result)
         return 0;
@@ -0,0 +1,111 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LargeObjectIndex.h"
+#include "Cell.h"
+#include <algorithm>
+
+namespace
+{
+    uint32 GetGridId(uint32 cellX, uint32 cellY)
+    {
+        return (cellX / MAX_NUMBER_OF_CELLS) * MAX_NUMBER_OF_GRIDS + cellY / MAX_NUMBER_OF_CELLS;
+    }
+}
+
+void LargeObjectIndex::Insert(WorldObject* obj, CellCoord const& cell)
+{
+    uint32 gridId = GetGridId(cell.x_coord, cell.y_coord);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    auto [itr, inserted] = _objectBuckets.try_emplace(obj, gridId);
+    if (!inserted)
+    {
+        std::vector<Entry>& oldBucket = _buckets[itr->second];
+        if (itr->second == gridId)
+        {
+            for (Entry& entry : oldBucket)
+                if (entry.Object == obj)
+                    entry.Cell = cell;
+            return;
+        }
+
+        oldBucket.erase(std::remove_if(oldBucket.begin(), oldBucket.end(), [obj](Entry const& entry) { return entry.Object == obj; }), oldBucket.end());
+        if (oldBucket.empty())
+            _buckets.erase(itr->second);
+
+        itr->second = gridId;
+    }
+
+    _buckets[gridId].push_back({ obj, cell });
+}
+
+void LargeObjectIndex::Remove(WorldObject* obj)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto itr = _objectBuckets.find(obj);
+    if (itr == _objectBuckets.end())
+        return;
+
+    auto bucket = _buckets.find(itr->second);
+    if (bucket != _buckets.end())
+    {
+        std::vector<Entry>& entries = bucket->second;
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [obj](Entry const& entry) { return entry.Object == obj; }), entries.end());
+        if (entries.empty())
+            _buckets.erase(bucket);
+    }
+
+    _objectBuckets.erase(itr);
+}
+
+uint32 LargeObjectIndex::CollectInArea(CellArea const& area, std::vector<WorldObject*>& objects) const
+{
+    uint32 gridLowX = area.low_bound.x_coord / MAX_NUMBER_OF_CELLS;
+    uint32 gridLowY = area.low_bound.y_coord / MAX_NUMBER_OF_CELLS;
+    uint32 gridHighX = area.high_bound.x_coord / MAX_NUMBER_OF_CELLS;
+    uint32 gridHighY = area.high_bound.y_coord / MAX_NUMBER_OF_CELLS;
+    uint32 examined = 0;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_buckets.empty())
+        return 0;
+
+    for (uint32 x = gridLowX; x <= gridHighX; ++x)
+    {
+        for (uint32 y = gridLowY; y <= gridHighY; ++y)
+        {
+            ++examined;
+            auto bucket = _buckets.find(x * MAX_NUMBER_OF_GRIDS + y);
+            if (bucket == _buckets.end())
+                continue;
+
+            for (Entry const& entry : bucket->second)
+                if (entry.Cell.x_coord >= area.low_bound.x_coord && entry.Cell.x_coord <= area.high_bound.x_coord &&
+                    entry.Cell.y_coord >= area.low_bound.y_coord && entry.Cell.y_coord <= area.high_bound.y_coord)
+                    objects.push_back(entry.Object);
+        }
+    }
+
+    return examined;
+}
+
+std::size_t LargeObjectIndex::Size() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _objectBuckets.size();
+}
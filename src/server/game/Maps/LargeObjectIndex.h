@@ -0,0 +1,56 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LARGE_OBJECT_INDEX_H_INCLUDED
+#define _LARGE_OBJECT_INDEX_H_INCLUDED
+
+#include "GridDefines.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class WorldObject;
+struct CellArea;
+
+// Objects with an overridden visibility distance, bucketed by the grid they are stored in.
+// Lets the large object visibility pass of a relocation look at the few large objects
+// around the viewer instead of sweeping every cell within MAX_VISIBILITY_DISTANCE.
+class LargeObjectIndex
+{
+public:
+    // Adds the object or moves it to the bucket of the given cell
+    void Insert(WorldObject* obj, CellCoord const& cell);
+    void Remove(WorldObject* obj);
+
+    // Appends the indexed objects whose current cell lies within the area, returns the number of buckets examined
+    uint32 CollectInArea(CellArea const& area, std::vector<WorldObject*>& objects) const;
+
+    [[nodiscard]] std::size_t Size() const;
+
+private:
+    struct Entry
+    {
+        WorldObject* Object;
+        CellCoord Cell;
+    };
+
+    std::unordered_map<uint32 /*gridId*/, std::vector<Entry>> _buckets;
+    std::unordered_map<WorldObject*, uint32 /*gridId*/> _objectBuckets;
+    mutable std::mutex _lock;
+};
+
+#endif
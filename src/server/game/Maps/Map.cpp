@@ -28,6 +28,8 @@
 #include "InstanceScript.h"
 #include "LFGMgr.h"
 #include "MapInstanced.h"
+#include "MapMgr.h"
+#include "MappedFile.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "Object.h"
@@ -213,7 +215,7 @@ void Map::LoadMap(int gx, int gy, bool reload)
     LOG_DEBUG("maps", "Loading map {}", tmp);
     // loading data
     GridMaps[gx][gy] = new GridMap();
-    if (!GridMaps[gx][gy]->loadData(tmp))
+    if (!GridMaps[gx][gy]->loadData(tmp, sWorld->getBoolConfig(CONFIG_MEMORY_MAPPED_MAPS)))
     {
         LOG_ERROR("maps", "Error loading map file: \n {}\n", tmp);
     }
@@ -236,7 +238,7 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id)), _lastUpdateCost(0), _largeVisibilityPasses(0), _largeVisibilityGridsVisited(0), _collectRegionCells(false)
 {
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx = 0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
@@ -466,6 +468,11 @@ void Map::EnsureGridCreated_i(const GridCoord& p)
 //Create NGrid and load the object data in it
 bool Map::EnsureGridLoaded(const Cell& cell)
 {
+    if (getNGrid(cell.GridX(), cell.GridY()) && isGridObjectDataLoaded(cell.GridX(), cell.GridY()))
+        return false;
+
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
     NGridType* grid = getNGrid(cell.GridX(), cell.GridY());
 
@@ -519,6 +526,7 @@ bool Map::AddPlayerToMap(Player* player)
     ASSERT (player->GetMap() == this);
     player->SetMap(this);
     player->AddToWorld();
+    UpdateFarSightPlayer(player);
 
     SendInitTransports(player);
     SendInitSelf(player);
@@ -554,6 +562,8 @@ void Map::InitializeObject(GameObject*  /*obj*/)
 template<class T>
 bool Map::AddToMap(T* obj, bool checkTransport)
 {
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     //TODO: Needs clean up. An object should not be added to map twice.
     if (obj->IsInWorld())
     {
@@ -687,6 +697,13 @@ void Map::VisitNearbyCellsOfPlayer(Player* player, TypeContainerVisitor<Acore::O
             CellCoord pair(x, y);
             Cell cell(pair);
 
+            if (_collectRegionCells)
+            {
+                EnsureGridLoaded(cell);
+                _regionCells.LargeCells.push_back(cell_id);
+                continue;
+            }
+
             Visit(cell, largeGridVisitor);
             Visit(cell, largeWorldVisitor);
         }
@@ -720,6 +737,21 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Acore::Objec
             Cell cell(pair);
             //cell.SetNoCreate(); // in mmaps this is missing
 
+            if (_collectRegionCells)
+            {
+                // grids are loaded here, the parallel region phase must not load anything
+                EnsureGridLoaded(cell);
+                _regionCells.Cells.push_back(cell_id);
+
+                if (!isCellMarkedLarge(cell_id))
+                {
+                    markCellLarge(cell_id);
+                    _regionCells.LargeCells.push_back(cell_id);
+                }
+
+                continue;
+            }
+
             Visit(cell, gridVisitor);
             Visit(cell, worldVisitor);
 
@@ -790,6 +822,12 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     std::vector<Creature*> updateList;
     updateList.reserve(10);
 
+    // MapUpdate.Regions: only collect the cells here, their objects are updated by region afterwards
+    MapRegionUpdater* regionUpdater = sMapMgr->GetRegionUpdater();
+    _collectRegionCells = regionUpdater->IsActive() && !Instanceable();
+    if (_collectRegionCells)
+        _regionCells.Clear();
+
     // non-player active objects, increasing iterator in the loop in case of object removal
     for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
     {
@@ -849,6 +887,12 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    if (_collectRegionCells)
+    {
+        _collectRegionCells = false;
+        regionUpdater->UpdateCells(*this, _regionCells, t_diff);
+    }
+
     for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();) // pussywizard: transports updated after VisitNearbyCellsOf, grids around are loaded, everything ok
     {
         MotionTransport* transport = *_transportsUpdateIter;
@@ -885,6 +929,55 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (_largeVisibilityPasses)
+    {
+        METRIC_VALUE("map_large_visibility_passes", uint64(_largeVisibilityPasses),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_large_visibility_grids_visited", uint64(_largeVisibilityGridsVisited),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        _largeVisibilityPasses = 0;
+        _largeVisibilityGridsVisited = 0;
+    }
+}
+
+void Map::AddObjectToDelayedVisibility(Unit* unit)
+{
+    if (MapRegionUpdateContext* context = MapRegionUpdater::CurrentContext())
+        context->DelayedVisibility.push_back(unit);
+    else
+        i_objectsForDelayedVisibility.insert(unit);
+}
+
+void Map::MergeRegionUpdateContext(MapRegionUpdateContext& context)
+{
+    _creaturesToMove.insert(_creaturesToMove.end(), context.CreaturesToMove.begin(), context.CreaturesToMove.end());
+    _gameObjectsToMove.insert(_gameObjectsToMove.end(), context.GameObjectsToMove.begin(), context.GameObjectsToMove.end());
+    _dynamicObjectsToMove.insert(_dynamicObjectsToMove.end(), context.DynamicObjectsToMove.begin(), context.DynamicObjectsToMove.end());
+    i_objectsForDelayedVisibility.insert(context.DelayedVisibility.begin(), context.DelayedVisibility.end());
+
+    // replay in order, an object may have been added and removed again during the region update
+    for (auto const& [object, add] : context.UpdateObjects)
+    {
+        if (add)
+            _updateObjects.insert(object);
+        else
+            _updateObjects.erase(object);
+    }
+
+    context.Clear();
+}
+
+std::unique_lock<std::recursive_mutex> Map::AcquireRegionUpdateLock() const
+{
+    if (!MapRegionUpdater::CurrentContext())
+        return std::unique_lock<std::recursive_mutex>();
+
+    return std::unique_lock<std::recursive_mutex>(_regionUpdateLock);
 }
 
 void Map::HandleDelayedVisibility()
@@ -896,6 +989,59 @@ void Map::HandleDelayedVisibility()
     i_objectsForDelayedVisibility.clear();
 }
 
+void Map::UpdateLargeObjectIndex(WorldObject* obj)
+{
+    if (!obj->IsVisibilityOverridden())
+        return;
+
+    // only objects stored in a grid are found by the cell sweep this index replaces
+    if (Creature* creature = obj->ToCreature())
+    {
+        if (creature->IsInGrid())
+            _largeObjects.Insert(obj, creature->GetCurrentCell().GetCellCoord());
+    }
+    else if (GameObject* go = obj->ToGameObject())
+    {
+        if (go->IsInGrid())
+            _largeObjects.Insert(obj, go->GetCurrentCell().GetCellCoord());
+    }
+}
+
+void Map::RemoveFromLargeObjectIndex(WorldObject* obj)
+{
+    if (obj->IsVisibilityOverridden())
+        _largeObjects.Remove(obj);
+}
+
+void Map::VisitLargeObjects(WorldObject const* viewPoint, Acore::PlayerRelocationNotifier& notifier)
+{
+    // the full sweep also updated the visibility between the mover and every player up to MAX_VISIBILITY_DISTANCE;
+    // all players within their sight range of the mover are already in its own sweep, except those using far sight
+    for (Player* player : _farSightPlayers)
+        if (player != &notifier.i_player && player->IsInWorld() && viewPoint->GetExactDist2dSq(player) <= MAX_VISIBILITY_DISTANCE * MAX_VISIBILITY_DISTANCE)
+            notifier.Visit(player);
+
+    // same area Cell::VisitAllObjects covers for a MAX_VISIBILITY_DISTANCE search around viewPoint
+    CellArea area = Cell::CalculateCellArea(viewPoint->GetPositionX(), viewPoint->GetPositionY(), MAX_VISIBILITY_DISTANCE + viewPoint->GetCombatReach());
+
+    _largeObjectCandidates.clear();
+    ++_largeVisibilityPasses;
+    _largeVisibilityGridsVisited += _largeObjects.CollectInArea(area, _largeObjectCandidates);
+
+    for (WorldObject* obj : _largeObjectCandidates)
+        notifier.VisibleNotifier::Visit(obj);
+}
+
+void Map::UpdateFarSightPlayer(Player* player)
+{
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
+    if (player->GetFarSightDistance())
+        _farSightPlayers.insert(player);
+    else
+        _farSightPlayers.erase(player);
+}
+
 struct ResetNotifier
 {
     template<class T>inline void resetNotify(GridRefMgr<T>& m)
@@ -914,6 +1060,7 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
 
     bool inWorld = player->IsInWorld();
     player->RemoveFromWorld();
+    _farSightPlayers.erase(player);
     SendRemoveTransports(player);
 
     if (!inWorld) // pussywizard: if was in world, RemoveFromWorld() called DestroyForNearbyPlayers()
@@ -938,6 +1085,8 @@ void Map::AfterPlayerUnlinkFromMap()
 template<class T>
 void Map::RemoveFromMap(T* obj, bool remove)
 {
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     bool inWorld = obj->IsInWorld() && obj->GetTypeId() >= TYPEID_UNIT && obj->GetTypeId() <= TYPEID_GAMEOBJECT;
     obj->RemoveFromWorld();
 
@@ -1016,7 +1165,8 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float o)
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
     player->UpdatePositionData();
-    player->UpdateObjectVisibility(false);
+    // not UpdateObjectVisibility(), plain movement keeps the incremental visibility state of the player
+    player->AddToNotify(NOTIFY_VISIBILITY_CHANGED);
 }
 
 void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float o)
@@ -1085,7 +1235,10 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
 void Map::AddCreatureToMoveList(Creature* c)
 {
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _creaturesToMove.push_back(c);
+    {
+        MapRegionUpdateContext* context = MapRegionUpdater::CurrentContext();
+        (context ? context->CreaturesToMove : _creaturesToMove).push_back(c);
+    }
     c->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
 }
 
@@ -1098,7 +1251,10 @@ void Map::RemoveCreatureFromMoveList(Creature* c)
 void Map::AddGameObjectToMoveList(GameObject* go)
 {
     if (go->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _gameObjectsToMove.push_back(go);
+    {
+        MapRegionUpdateContext* context = MapRegionUpdater::CurrentContext();
+        (context ? context->GameObjectsToMove : _gameObjectsToMove).push_back(go);
+    }
     go->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
 }
 
@@ -1111,7 +1267,10 @@ void Map::RemoveGameObjectFromMoveList(GameObject* go)
 void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj)
 {
     if (dynObj->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _dynamicObjectsToMove.push_back(dynObj);
+    {
+        MapRegionUpdateContext* context = MapRegionUpdater::CurrentContext();
+        (context ? context->DynamicObjectsToMove : _dynamicObjectsToMove).push_back(dynObj);
+    }
     dynObj->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
 }
 
@@ -1146,6 +1305,7 @@ void Map::MoveAllCreaturesInMoveList()
         if (old_cell.DiffGrid(new_cell))
             EnsureGridLoaded(new_cell);
         AddToGrid(c, new_cell);
+        UpdateLargeObjectIndex(c);
     }
     _creaturesToMove.clear();
 }
@@ -1175,6 +1335,7 @@ void Map::MoveAllGameObjectsInMoveList()
         if (old_cell.DiffGrid(new_cell))
             EnsureGridLoaded(new_cell);
         AddToGrid(go, new_cell);
+        UpdateLargeObjectIndex(go);
     }
     _gameObjectsToMove.clear();
 }
@@ -1351,11 +1512,27 @@ GridMap::~GridMap()
     unloadData();
 }
 
-bool GridMap::loadData(char* filename)
+bool GridMap::loadData(char* filename, bool memoryMapped)
 {
     // Unload old data if exist
     unloadData();
 
+    if (memoryMapped)
+    {
+        // missing files and files which can not be mapped are handled below
+        _mappedFile = std::make_unique<MappedFile>();
+        if (!_mappedFile->Open(filename))
+            _mappedFile.reset();
+        else if (loadMappedData())
+            return true;
+        else
+        {
+            // sections which are not aligned for their element type are read as usual
+            LOG_DEBUG("maps", "Map file '{}' can not be used memory mapped, reading it instead.", filename);
+            unloadData();
+        }
+    }
+
     map_fileheader header;
     // Not return error if file not found
     FILE* in = fopen(filename, "rb");
@@ -1408,15 +1585,21 @@ bool GridMap::loadData(char* filename)
 
 void GridMap::unloadData()
 {
-    delete[] _areaMap;
-    delete[] m_V9;
-    delete[] m_V8;
-    delete[] _maxHeight;
-    delete[] _minHeight;
-    delete[] _liquidEntry;
-    delete[] _liquidFlags;
-    delete[] _liquidMap;
-    delete[] _holes;
+    if (_mappedFile)
+        _mappedFile.reset();
+    else
+    {
+        delete[] _areaMap;
+        delete[] m_V9;
+        delete[] m_V8;
+        delete[] _maxHeight;
+        delete[] _minHeight;
+        delete[] _liquidEntry;
+        delete[] _liquidFlags;
+        delete[] _liquidMap;
+        delete[] _holes;
+    }
+
     _areaMap = nullptr;
     m_V9 = nullptr;
     m_V8 = nullptr;
@@ -1429,6 +1612,107 @@ void GridMap::unloadData()
     _gridGetHeight = &GridMap::getHeightFromFlat;
 }
 
+bool GridMap::loadMappedData()
+{
+    map_fileheader const* header = _mappedFile->GetArray<map_fileheader>(0, 1);
+    if (!header || header->mapMagic != MapMagic.asUInt || header->versionMagic != MapVersionMagic)
+        return false;
+
+    // same layout loadAreaData, loadHeightData, loadLiquidData and loadHolesData read, but pointing into the mapping
+    if (header->areaMapOffset)
+    {
+        map_areaHeader const* areaHeader = _mappedFile->GetArray<map_areaHeader>(header->areaMapOffset, 1);
+        if (!areaHeader || areaHeader->fourcc != MapAreaMagic.asUInt)
+            return false;
+
+        _gridArea = areaHeader->gridArea;
+        if (!(areaHeader->flags & MAP_AREA_NO_AREA) && !(_areaMap = _mappedFile->GetArray<uint16>(header->areaMapOffset + sizeof(map_areaHeader), 16 * 16)))
+            return false;
+    }
+
+    if (header->heightMapOffset)
+    {
+        map_heightHeader const* heightHeader = _mappedFile->GetArray<map_heightHeader>(header->heightMapOffset, 1);
+        if (!heightHeader || heightHeader->fourcc != MapHeightMagic.asUInt)
+            return false;
+
+        std::size_t offset = header->heightMapOffset + sizeof(map_heightHeader);
+        _gridHeight = heightHeader->gridHeight;
+        if (!(heightHeader->flags & MAP_HEIGHT_NO_HEIGHT))
+        {
+            if ((heightHeader->flags & MAP_HEIGHT_AS_INT16))
+            {
+                m_uint16_V9 = _mappedFile->GetArray<uint16>(offset, 129 * 129);
+                m_uint16_V8 = _mappedFile->GetArray<uint16>(offset + sizeof(uint16) * 129 * 129, 128 * 128);
+                offset += sizeof(uint16) * (129 * 129 + 128 * 128);
+                _gridIntHeightMultiplier = (heightHeader->gridMaxHeight - heightHeader->gridHeight) / 65535;
+                _gridGetHeight = &GridMap::getHeightFromUint16;
+            }
+            else if ((heightHeader->flags & MAP_HEIGHT_AS_INT8))
+            {
+                m_uint8_V9 = _mappedFile->GetArray<uint8>(offset, 129 * 129);
+                m_uint8_V8 = _mappedFile->GetArray<uint8>(offset + sizeof(uint8) * 129 * 129, 128 * 128);
+                offset += sizeof(uint8) * (129 * 129 + 128 * 128);
+                _gridIntHeightMultiplier = (heightHeader->gridMaxHeight - heightHeader->gridHeight) / 255;
+                _gridGetHeight = &GridMap::getHeightFromUint8;
+            }
+            else
+            {
+                m_V9 = _mappedFile->GetArray<float>(offset, 129 * 129);
+                m_V8 = _mappedFile->GetArray<float>(offset + sizeof(float) * 129 * 129, 128 * 128);
+                offset += sizeof(float) * (129 * 129 + 128 * 128);
+                _gridGetHeight = &GridMap::getHeightFromFloat;
+            }
+
+            if (!m_V9 || !m_V8)
+                return false;
+        }
+        else
+            _gridGetHeight = &GridMap::getHeightFromFlat;
+
+        if (heightHeader->flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS)
+        {
+            _maxHeight = _mappedFile->GetArray<int16>(offset, 3 * 3);
+            _minHeight = _mappedFile->GetArray<int16>(offset + sizeof(int16) * 3 * 3, 3 * 3);
+            if (!_maxHeight || !_minHeight)
+                return false;
+        }
+    }
+
+    if (header->liquidMapOffset)
+    {
+        map_liquidHeader const* liquidHeader = _mappedFile->GetArray<map_liquidHeader>(header->liquidMapOffset, 1);
+        if (!liquidHeader || liquidHeader->fourcc != MapLiquidMagic.asUInt)
+            return false;
+
+        _liquidGlobalEntry = liquidHeader->liquidType;
+        _liquidGlobalFlags = liquidHeader->liquidFlags;
+        _liquidOffX  = liquidHeader->offsetX;
+        _liquidOffY  = liquidHeader->offsetY;
+        _liquidWidth = liquidHeader->width;
+        _liquidHeight = liquidHeader->height;
+        _liquidLevel  = liquidHeader->liquidLevel;
+
+        std::size_t offset = header->liquidMapOffset + sizeof(map_liquidHeader);
+        if (!(liquidHeader->flags & MAP_LIQUID_NO_TYPE))
+        {
+            _liquidEntry = _mappedFile->GetArray<uint16>(offset, 16 * 16);
+            _liquidFlags = _mappedFile->GetArray<uint8>(offset + sizeof(uint16) * 16 * 16, 16 * 16);
+            offset += (sizeof(uint16) + sizeof(uint8)) * 16 * 16;
+            if (!_liquidEntry || !_liquidFlags)
+                return false;
+        }
+
+        if (!(liquidHeader->flags & MAP_LIQUID_NO_HEIGHT) && !(_liquidMap = _mappedFile->GetArray<float>(offset, uint32(_liquidWidth) * uint32(_liquidHeight))))
+            return false;
+    }
+
+    if (header->holesSize && !(_holes = _mappedFile->GetArray<uint16>(header->holesOffset, 16 * 16)))
+        return false;
+
+    return true;
+}
+
 bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
 {
     map_areaHeader header;
@@ -1440,8 +1724,9 @@ bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
     _gridArea = header.gridArea;
     if (!(header.flags & MAP_AREA_NO_AREA))
     {
-        _areaMap = new uint16 [16 * 16];
-        if (fread(_areaMap, sizeof(uint16), 16 * 16, in) != 16 * 16)
+        uint16* areaMap = new uint16 [16 * 16];
+        _areaMap = areaMap;
+        if (fread(areaMap, sizeof(uint16), 16 * 16, in) != 16 * 16)
             return false;
     }
     return true;
@@ -1460,30 +1745,36 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         if ((header.flags & MAP_HEIGHT_AS_INT16))
         {
-            m_uint16_V9 = new uint16 [129 * 129];
-            m_uint16_V8 = new uint16 [128 * 128];
-            if (fread(m_uint16_V9, sizeof(uint16), 129 * 129, in) != 129 * 129 ||
-                    fread(m_uint16_V8, sizeof(uint16), 128 * 128, in) != 128 * 128)
+            uint16* v9 = new uint16 [129 * 129];
+            uint16* v8 = new uint16 [128 * 128];
+            m_uint16_V9 = v9;
+            m_uint16_V8 = v8;
+            if (fread(v9, sizeof(uint16), 129 * 129, in) != 129 * 129 ||
+                    fread(v8, sizeof(uint16), 128 * 128, in) != 128 * 128)
                 return false;
             _gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
             _gridGetHeight = &GridMap::getHeightFromUint16;
         }
         else if ((header.flags & MAP_HEIGHT_AS_INT8))
         {
-            m_uint8_V9 = new uint8 [129 * 129];
-            m_uint8_V8 = new uint8 [128 * 128];
-            if (fread(m_uint8_V9, sizeof(uint8), 129 * 129, in) != 129 * 129 ||
-                    fread(m_uint8_V8, sizeof(uint8), 128 * 128, in) != 128 * 128)
+            uint8* v9 = new uint8 [129 * 129];
+            uint8* v8 = new uint8 [128 * 128];
+            m_uint8_V9 = v9;
+            m_uint8_V8 = v8;
+            if (fread(v9, sizeof(uint8), 129 * 129, in) != 129 * 129 ||
+                    fread(v8, sizeof(uint8), 128 * 128, in) != 128 * 128)
                 return false;
             _gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             _gridGetHeight = &GridMap::getHeightFromUint8;
         }
         else
         {
-            m_V9 = new float [129 * 129];
-            m_V8 = new float [128 * 128];
-            if (fread(m_V9, sizeof(float), 129 * 129, in) != 129 * 129 ||
-                    fread(m_V8, sizeof(float), 128 * 128, in) != 128 * 128)
+            float* v9 = new float [129 * 129];
+            float* v8 = new float [128 * 128];
+            m_V9 = v9;
+            m_V8 = v8;
+            if (fread(v9, sizeof(float), 129 * 129, in) != 129 * 129 ||
+                    fread(v8, sizeof(float), 128 * 128, in) != 128 * 128)
                 return false;
             _gridGetHeight = &GridMap::getHeightFromFloat;
         }
@@ -1493,10 +1784,12 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
 
     if (header.flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS)
     {
-        _maxHeight = new int16[3 * 3];
-        _minHeight = new int16[3 * 3];
-        if (fread(_maxHeight, sizeof(int16), 3 * 3, in) != 3 * 3 ||
-                fread(_minHeight, sizeof(int16), 3 * 3, in) != 3 * 3)
+        int16* maxHeight = new int16[3 * 3];
+        int16* minHeight = new int16[3 * 3];
+        _maxHeight = maxHeight;
+        _minHeight = minHeight;
+        if (fread(maxHeight, sizeof(int16), 3 * 3, in) != 3 * 3 ||
+                fread(minHeight, sizeof(int16), 3 * 3, in) != 3 * 3)
             return false;
     }
 
@@ -1521,18 +1814,21 @@ bool GridMap::loadLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
 
     if (!(header.flags & MAP_LIQUID_NO_TYPE))
     {
-        _liquidEntry = new uint16[16 * 16];
-        if (fread(_liquidEntry, sizeof(uint16), 16 * 16, in) != 16 * 16)
+        uint16* liquidEntry = new uint16[16 * 16];
+        _liquidEntry = liquidEntry;
+        if (fread(liquidEntry, sizeof(uint16), 16 * 16, in) != 16 * 16)
             return false;
 
-        _liquidFlags = new uint8[16 * 16];
-        if (fread(_liquidFlags, sizeof(uint8), 16 * 16, in) != 16 * 16)
+        uint8* liquidFlags = new uint8[16 * 16];
+        _liquidFlags = liquidFlags;
+        if (fread(liquidFlags, sizeof(uint8), 16 * 16, in) != 16 * 16)
             return false;
     }
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
-        _liquidMap = new float[uint32(_liquidWidth) * uint32(_liquidHeight)];
-        if (fread(_liquidMap, sizeof(float), _liquidWidth * _liquidHeight, in) != (uint32(_liquidWidth) * uint32(_liquidHeight)))
+        float* liquidMap = new float[uint32(_liquidWidth) * uint32(_liquidHeight)];
+        _liquidMap = liquidMap;
+        if (fread(liquidMap, sizeof(float), _liquidWidth * _liquidHeight, in) != (uint32(_liquidWidth) * uint32(_liquidHeight)))
             return false;
     }
     return true;
@@ -1543,8 +1839,9 @@ bool GridMap::loadHolesData(FILE* in, uint32 offset, uint32 /*size*/)
     if (fseek(in, offset, SEEK_SET) != 0)
         return false;
 
-    _holes = new uint16[16 * 16];
-    if (fread(_holes, sizeof(uint16), 16 * 16, in) != 16 * 16)
+    uint16* holes = new uint16[16 * 16];
+    _holes = holes;
+    if (fread(holes, sizeof(uint16), 16 * 16, in) != 16 * 16)
         return false;
 
     return true;
@@ -1671,7 +1968,7 @@ float GridMap::getHeightFromUint8(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint8* V9_h1_ptr = &m_uint8_V9[x_int * 128 + x_int + y_int];
+    uint8 const* V9_h1_ptr = &m_uint8_V9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -1741,7 +2038,7 @@ float GridMap::getHeightFromUint16(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint16* V9_h1_ptr = &m_uint16_V9[x_int * 128 + x_int + y_int];
+    uint16 const* V9_h1_ptr = &m_uint16_V9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -2475,6 +2772,41 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
     return true;
 }
 
+void Map::isInLineOfSight(std::vector<VMAP::LineOfSightSegment>& segments, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    if (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_PVP_LOS))
+    {
+        if (IsBattlegroundOrArena())
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        }
+    }
+
+    if (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD))
+    {
+        if (IsWorldMap())
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        }
+    }
+
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+    {
+        VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), segments, ignoreFlags);
+    }
+
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
+    {
+        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::M2;
+        }
+
+        _dynamicTree.isInLineOfSight(segments, phasemask, ignoreFlags);
+    }
+}
+
 bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
@@ -2652,6 +2984,8 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 {
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
 
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     obj->CleanupsBeforeDelete(false);                            // remove or simplify at least cross referenced links
 
     i_objectsToRemove.insert(obj);
@@ -2666,6 +3000,8 @@ void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
     if (obj->GetTypeId() != TYPEID_UNIT && obj->GetTypeId() != TYPEID_GAMEOBJECT)
         return;
 
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     std::map<WorldObject*, bool>::iterator itr = i_objectsToSwitch.find(obj);
     if (itr == i_objectsToSwitch.end())
         i_objectsToSwitch.insert(itr, std::make_pair(obj, on));
@@ -2753,8 +3089,9 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    SharedWorldPacketPtr sharedData = std::make_shared<SharedWorldPacket>(*data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->GetSession()->SendPacket(data);
+        itr->GetSource()->GetSession()->SendSharedPacket(sharedData);
 }
 
 template<class T>
@@ -3348,6 +3685,8 @@ void Map::UpdateIteratorBack(Player* player)
 
 void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 {
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     if (!respawnTime)
     {
         // Delete only
@@ -3371,6 +3710,8 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTi
 
 void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
 {
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     _creatureRespawnTimes.erase(spawnId);
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
@@ -3382,6 +3723,8 @@ void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
 
 void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 {
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     if (!respawnTime)
     {
         // Delete only
@@ -3405,6 +3748,8 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 
 void Map::RemoveGORespawnTime(ObjectGuid::LowType spawnId)
 {
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     _goRespawnTimes.erase(spawnId);
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
@@ -26,7 +26,9 @@
 #include "GameObjectModel.h"
 #include "GridDefines.h"
 #include "GridRefMgr.h"
+#include "LargeObjectIndex.h"
 #include "MapRefMgr.h"
+#include "MapRegionUpdater.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
 #include "PathGenerator.h"
@@ -61,6 +63,7 @@ class Transport;
 class StaticTransport;
 class MotionTransport;
 class PathGenerator;
+class MappedFile;
 
 enum WeatherState : uint32;
 
@@ -73,6 +76,7 @@ namespace Acore
 {
     struct ObjectUpdater;
     struct LargeObjectUpdater;
+    struct PlayerRelocationNotifier;
 }
 
 struct ScriptAction
@@ -201,32 +205,34 @@ enum LineOfSightChecks
 class GridMap
 {
     uint32  _flags;
+    // arrays point into _mappedFile when the map file is memory mapped, they are owned otherwise
+    std::unique_ptr<MappedFile> _mappedFile;
     union
     {
-        float* m_V9;
-        uint16* m_uint16_V9;
-        uint8* m_uint8_V9;
+        float const* m_V9;
+        uint16 const* m_uint16_V9;
+        uint8 const* m_uint8_V9;
     };
     union
     {
-        float* m_V8;
-        uint16* m_uint16_V8;
-        uint8* m_uint8_V8;
+        float const* m_V8;
+        uint16 const* m_uint16_V8;
+        uint8 const* m_uint8_V8;
     };
-    int16* _maxHeight;
-    int16* _minHeight;
+    int16 const* _maxHeight;
+    int16 const* _minHeight;
     // Height level data
     float _gridHeight;
     float _gridIntHeightMultiplier;
 
     // Area data
-    uint16* _areaMap;
+    uint16 const* _areaMap;
 
     // Liquid data
     float _liquidLevel;
-    uint16* _liquidEntry;
-    uint8* _liquidFlags;
-    float* _liquidMap;
+    uint16 const* _liquidEntry;
+    uint8 const* _liquidFlags;
+    float const* _liquidMap;
     uint16 _gridArea;
     uint16 _liquidGlobalEntry;
     uint8 _liquidGlobalFlags;
@@ -234,8 +240,9 @@ class GridMap
     uint8 _liquidOffY;
     uint8 _liquidWidth;
     uint8 _liquidHeight;
-    uint16* _holes;
+    uint16 const* _holes;
 
+    bool loadMappedData();
     bool loadAreaData(FILE* in, uint32 offset, uint32 size);
     bool loadHeightData(FILE* in, uint32 offset, uint32 size);
     bool loadLiquidData(FILE* in, uint32 offset, uint32 size);
@@ -253,7 +260,7 @@ class GridMap
 public:
     GridMap();
     ~GridMap();
-    bool loadData(char* filaname);
+    bool loadData(char* filaname, bool memoryMapped = false);
     void unloadData();
 
     [[nodiscard]] uint16 getArea(float x, float y) const;
@@ -348,6 +355,10 @@ public:
 
     virtual void Update(const uint32, const uint32, bool thread = true);
 
+    // Wall time spent in the last Update() call, used by MapUpdater to schedule expensive maps first
+    [[nodiscard]] Microseconds GetLastUpdateCost() const { return _lastUpdateCost; }
+    void SetLastUpdateCost(Microseconds cost) { _lastUpdateCost = cost; }
+
     [[nodiscard]] float GetVisibilityRange() const { return m_VisibleDistance; }
     void SetVisibilityRange(float range) { m_VisibleDistance = range; }
     //function for setting up visibility distance for maps on per-type/per-Id basis
@@ -387,8 +398,17 @@ public:
     [[nodiscard]] std::shared_mutex& GetMMapLock() const { return *(const_cast<std::shared_mutex*>(&MMapLock)); }
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
+    void AddObjectToDelayedVisibility(Unit* unit);
     void HandleDelayedVisibility();
 
+    // keeps the large object index in sync with objects whose visibility distance is overridden
+    void UpdateLargeObjectIndex(WorldObject* obj);
+    void RemoveFromLargeObjectIndex(WorldObject* obj);
+    // visits the large objects and the far sight players around viewPoint with notifier, replaces a cell sweep over MAX_VISIBILITY_DISTANCE
+    void VisitLargeObjects(WorldObject const* viewPoint, Acore::PlayerRelocationNotifier& notifier);
+    // players whose sight range is extended by far sight, the only ones seeing further than a mover's own sweep
+    void UpdateFarSightPlayer(Player* player);
+
     // some calls like isInWater should not use vmaps due to processor power
     // can return INVALID_HEIGHT if under z+2 z coord not found height
     [[nodiscard]] float GetHeight(float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
@@ -552,6 +572,8 @@ public:
     float GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, float* ground = nullptr, bool swim = false, float collisionHeight = DEFAULT_COLLISION_HEIGHT) const;
     [[nodiscard]] float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    // Batched isInLineOfSight, clears inLineOfSight of every blocked segment
+    void isInLineOfSight(std::vector<VMAP::LineOfSightSegment>& segments, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, PathGenerator *path, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
@@ -572,6 +594,8 @@ public:
     [[nodiscard]] time_t GetLinkedRespawnTime(ObjectGuid guid) const;
     [[nodiscard]] time_t GetCreatureRespawnTime(ObjectGuid::LowType dbGuid) const
     {
+        std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
         std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t>::const_iterator itr = _creatureRespawnTimes.find(dbGuid);
         if (itr != _creatureRespawnTimes.end())
             return itr->second;
@@ -581,6 +605,8 @@ public:
 
     [[nodiscard]] time_t GetGORespawnTime(ObjectGuid::LowType dbGuid) const
     {
+        std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
         std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t>::const_iterator itr = _goRespawnTimes.find(dbGuid);
         if (itr != _goRespawnTimes.end())
             return itr->second;
@@ -643,14 +669,23 @@ public:
 
     void AddUpdateObject(Object* obj)
     {
-        _updateObjects.insert(obj);
+        if (MapRegionUpdateContext* context = MapRegionUpdater::CurrentContext())
+            context->UpdateObjects.emplace_back(obj, true);
+        else
+            _updateObjects.insert(obj);
     }
 
     void RemoveUpdateObject(Object* obj)
     {
-        _updateObjects.erase(obj);
+        if (MapRegionUpdateContext* context = MapRegionUpdater::CurrentContext())
+            context->UpdateObjects.emplace_back(obj, false);
+        else
+            _updateObjects.erase(obj);
     }
 
+    // applies the side effects buffered while regions of this map were updated in parallel
+    void MergeRegionUpdateContext(MapRegionUpdateContext& context);
+
     std::size_t GetActiveNonPlayersCount() const
     {
         return m_activeNonPlayers.size();
@@ -698,6 +733,9 @@ private:
 
     void UpdateActiveCells(const float& x, const float& y, const uint32 t_diff);
 
+    // returns an owned lock while regions are updated in parallel, an empty one otherwise
+    std::unique_lock<std::recursive_mutex> AcquireRegionUpdateLock() const;
+
     void SendObjectUpdates();
 
 protected:
@@ -804,6 +842,19 @@ private:
     std::unordered_set<Corpse*> _corpseBones;
 
     std::unordered_set<Object*> _updateObjects;
+
+    Microseconds _lastUpdateCost;
+
+    LargeObjectIndex _largeObjects;
+    std::vector<WorldObject*> _largeObjectCandidates;
+    std::unordered_set<Player*> _farSightPlayers;
+    uint32 _largeVisibilityPasses;
+    uint32 _largeVisibilityGridsVisited;
+
+    // MapUpdate.Regions: cells collected during the tick and the lock guarding structural changes
+    bool _collectRegionCells;
+    MapRegionCells _regionCells;
+    mutable std::recursive_mutex _regionUpdateLock;
 };
 
 enum InstanceResetMethod
@@ -58,6 +58,10 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    // Parallel update of continent regions
+    if (sWorld->getBoolConfig(CONFIG_MAP_UPDATE_REGIONS) && sWorld->getIntConfig(CONFIG_MAP_UPDATE_REGIONS_THREADS) > 0)
+        m_regionUpdater.Activate(sWorld->getIntConfig(CONFIG_MAP_UPDATE_REGIONS_THREADS), sWorld->getIntConfig(CONFIG_MAP_UPDATE_REGIONS_GRIDS));
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -333,6 +337,9 @@ void MapMgr::UnloadAll()
 
     if (m_updater.activated())
         m_updater.deactivate();
+
+    if (m_regionUpdater.IsActive())
+        m_regionUpdater.Deactivate();
 }
 
 void MapMgr::GetNumInstances(uint32& dungeons, uint32& battlegrounds, uint32& arenas)
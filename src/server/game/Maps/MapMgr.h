@@ -22,6 +22,7 @@
 #include "Define.h"
 #include "Map.h"
 #include "MapInstanced.h"
+#include "MapRegionUpdater.h"
 #include "MapUpdater.h"
 #include "Object.h"
 
@@ -152,6 +153,7 @@ public:
     uint32 GenerateInstanceId();
 
     MapUpdater* GetMapUpdater() { return &m_updater; }
+    MapRegionUpdater* GetRegionUpdater() { return &m_regionUpdater; }
 
     template<typename Worker>
     void DoForAllMaps(Worker&& worker);
@@ -177,6 +179,7 @@ private:
     InstanceIds _instanceIds;
     uint32 _nextInstanceId;
     MapUpdater m_updater;
+    MapRegionUpdater m_regionUpdater;
 };
 
 template<typename Worker>
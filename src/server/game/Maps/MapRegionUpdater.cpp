@@ -0,0 +1,313 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapRegionUpdater.h"
+#include "CellImpl.h"
+#include "DatabaseEnv.h"
+#include "GridNotifiers.h"
+#include "Map.h"
+#include "Metric.h"
+#include "ObjectDefines.h"
+#include "PoolMgr.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+// largest distance at which an updated object reaches other objects: visibility of large objects and gameobjects
+// and grid searches are all bounded by it
+static constexpr float REGION_UPDATE_REACH = MAX_VISIBILITY_DISTANCE + VISIBILITY_INC_FOR_GOBJECTS;
+
+namespace
+{
+    // same as Acore::ObjectUpdater, but leaves the objects that may reach outside of the region to the serial phase
+    struct RegionObjectUpdater
+    {
+        uint32 i_timeDiff;
+        bool i_largeOnly;
+        RegionObjectUpdater(uint32 diff, bool largeOnly) : i_timeDiff(diff), i_largeOnly(largeOnly) { }
+
+        template<class T> void Visit(GridRefMgr<T>& m)
+        {
+            for (typename GridRefMgr<T>::iterator iter = m.begin(); iter != m.end(); )
+            {
+                T* obj = iter->GetSource();
+                ++iter;
+                if (!obj->IsInWorld() || i_largeOnly != obj->IsVisibilityOverridden())
+                    continue;
+
+                if (MapRegionUpdater::MustUpdateSerially(obj))
+                    MapRegionUpdater::CurrentContext()->Deferred.push_back(obj);
+                else
+                    obj->Update(i_timeDiff);
+            }
+        }
+
+        void Visit(PlayerMapType&) { }
+        void Visit(CorpseMapType&) { }
+    };
+}
+
+void MapRegionUpdateContext::Clear()
+{
+    CreaturesToMove.clear();
+    GameObjectsToMove.clear();
+    DynamicObjectsToMove.clear();
+    DelayedVisibility.clear();
+    UpdateObjects.clear();
+    Deferred.clear();
+}
+
+MapRegionUpdater::MapRegionUpdater() : _cellsPerRegion(0), _haloCells(0), _cancelationToken(false)
+{
+}
+
+MapRegionUpdater::~MapRegionUpdater()
+{
+    Deactivate();
+}
+
+void MapRegionUpdater::Activate(std::size_t numThreads, uint32 gridsPerRegion)
+{
+    _haloCells = uint32(std::ceil(REGION_UPDATE_REACH / SIZE_OF_GRID_CELL)) + 1;
+    _cellsPerRegion = std::max<uint32>(gridsPerRegion, 1) * MAX_NUMBER_OF_CELLS;
+    // a region must keep some interior cells, otherwise everything ends up in the serial phase
+    while (_cellsPerRegion <= 2 * _haloCells)
+        _cellsPerRegion += MAX_NUMBER_OF_CELLS;
+    _cancelationToken = false;
+
+    _workerThreads.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&MapRegionUpdater::WorkerThread, this));
+}
+
+void MapRegionUpdater::Deactivate()
+{
+    {
+        std::lock_guard<std::mutex> guard(_queueLock);
+        _cancelationToken = true;
+    }
+
+    _queueCondition.notify_all();
+
+    for (auto& thread : _workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    _workerThreads.clear();
+}
+
+void MapRegionUpdater::UpdateCells(Map& map, MapRegionCells const& cells, uint32 diff)
+{
+    // regions are sorted by id so the merge order does not depend on thread timing
+    std::map<uint32, Region> regions;
+    std::vector<uint32> haloCells;
+    std::vector<uint32> haloLargeCells;
+
+    uint32 const regionsPerRow = (TOTAL_NUMBER_OF_CELLS_PER_MAP + _cellsPerRegion - 1) / _cellsPerRegion;
+    auto classify = [&](uint32 cellId, bool large)
+    {
+        uint32 x = cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP;
+        uint32 y = cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP;
+        uint32 localX = x % _cellsPerRegion;
+        uint32 localY = y % _cellsPerRegion;
+
+        if (localX < _haloCells || localX >= _cellsPerRegion - _haloCells ||
+            localY < _haloCells || localY >= _cellsPerRegion - _haloCells)
+        {
+            (large ? haloLargeCells : haloCells).push_back(cellId);
+            return;
+        }
+
+        uint32 regionId = (y / _cellsPerRegion) * regionsPerRow + (x / _cellsPerRegion);
+        Region& region = regions[regionId];
+        region.Id = regionId;
+        (large ? region.LargeCells : region.Cells).push_back(cellId);
+    };
+
+    for (uint32 cellId : cells.Cells)
+        classify(cellId, false);
+
+    for (uint32 cellId : cells.LargeCells)
+        classify(cellId, true);
+
+    if (regions.size() > 1)
+    {
+        METRIC_TIMER("map_region_update_time", METRIC_TAG("map_id", std::to_string(map.GetId())));
+
+        Batch batch;
+        batch.Remaining = regions.size();
+
+        {
+            std::lock_guard<std::mutex> guard(_queueLock);
+            for (auto& [regionId, region] : regions)
+            {
+                Region* regionPtr = &region;
+                _queue.push_back({ [&map, regionPtr, diff]()
+                {
+                    CurrentContext() = &regionPtr->Context;
+                    VisitCells<RegionObjectUpdater>(map, regionPtr->Cells, regionPtr->LargeCells, diff);
+                    CurrentContext() = nullptr;
+                }, &batch });
+            }
+        }
+
+        _queueCondition.notify_all();
+
+        // help with the queued jobs instead of just blocking the map update thread
+        while (RunPendingJob())
+        {
+            std::lock_guard<std::mutex> guard(batch.Lock);
+            if (!batch.Remaining)
+                break;
+        }
+
+        {
+            std::unique_lock<std::mutex> guard(batch.Lock);
+            batch.Condition.wait(guard, [&batch] { return batch.Remaining == 0; });
+        }
+
+        std::size_t deferredCount = 0;
+        for (auto const& [regionId, region] : regions)
+            deferredCount += region.Context.Deferred.size();
+
+        METRIC_VALUE("map_region_deferred_objects", uint64(deferredCount), METRIC_TAG("map_id", std::to_string(map.GetId())));
+
+        for (auto& [regionId, region] : regions)
+        {
+            // the context is cleared by the merge, take the deferred objects first
+            std::vector<WorldObject*> deferred = std::move(region.Context.Deferred);
+            map.MergeRegionUpdateContext(region.Context);
+
+            for (WorldObject* object : deferred)
+                if (object->IsInWorld())
+                    object->Update(diff);
+        }
+    }
+    else
+    {
+        // nothing to gain from the pool, visit everything on this thread
+        for (auto& [regionId, region] : regions)
+            VisitCells<Acore::ObjectUpdater>(map, region.Cells, region.LargeCells, diff);
+    }
+
+    METRIC_TIMER("map_region_halo_update_time", METRIC_TAG("map_id", std::to_string(map.GetId())));
+    VisitCells<Acore::ObjectUpdater>(map, haloCells, haloLargeCells, diff);
+}
+
+bool MapRegionUpdater::MustUpdateSerially(WorldObject const* object)
+{
+    if (object->isActiveObject())
+        return true;
+
+    // dying, despawning and respawning objects write the respawn times of the map and pooled ones
+    // spawn the next member of their pool anywhere on the map
+    switch (object->GetTypeId())
+    {
+        case TYPEID_UNIT:
+        {
+            Creature const* creature = object->ToCreature();
+            return creature->IsInCombat() || creature->GetCharmerOrOwnerGUID() || creature->IsVehicle() || creature->GetVehicle() ||
+                !creature->IsAlive() || (creature->GetSpawnId() && sPoolMgr->IsPartOfAPool<Creature>(creature->GetSpawnId()));
+        }
+        case TYPEID_GAMEOBJECT:
+        {
+            GameObject const* gameObject = object->ToGameObject();
+            return gameObject->GetOwnerGUID() || gameObject->getLootState() != GO_READY || gameObject->GetRespawnTime() ||
+                (gameObject->GetSpawnId() && sPoolMgr->IsPartOfAPool<GameObject>(gameObject->GetSpawnId()));
+        }
+        default:
+            // dynamic objects update the auras and the dynamic object list of their caster
+            return true;
+    }
+}
+
+template<class UPDATER>
+void MapRegionUpdater::VisitCells(Map& map, std::vector<uint32> const& cells, std::vector<uint32> const& largeCells, uint32 diff)
+{
+    UPDATER updater(diff, false);
+    TypeContainerVisitor<UPDATER, GridTypeMapContainer  > gridObjectUpdate(updater);
+    TypeContainerVisitor<UPDATER, WorldTypeMapContainer > worldObjectUpdate(updater);
+
+    UPDATER largeObjectUpdater(diff, true);
+    TypeContainerVisitor<UPDATER, GridTypeMapContainer  > gridLargeObjectUpdate(largeObjectUpdater);
+    TypeContainerVisitor<UPDATER, WorldTypeMapContainer > worldLargeObjectUpdate(largeObjectUpdater);
+
+    for (uint32 cellId : cells)
+    {
+        Cell cell(CellCoord(cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP, cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP));
+        map.Visit(cell, gridObjectUpdate);
+        map.Visit(cell, worldObjectUpdate);
+    }
+
+    for (uint32 cellId : largeCells)
+    {
+        Cell cell(CellCoord(cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP, cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP));
+        map.Visit(cell, gridLargeObjectUpdate);
+        map.Visit(cell, worldLargeObjectUpdate);
+    }
+}
+
+bool MapRegionUpdater::RunPendingJob()
+{
+    Job job;
+
+    {
+        std::lock_guard<std::mutex> guard(_queueLock);
+        if (_queue.empty())
+            return false;
+
+        job = std::move(_queue.front());
+        _queue.pop_front();
+    }
+
+    RunJob(job);
+    return true;
+}
+
+void MapRegionUpdater::RunJob(Job& job)
+{
+    job.Task();
+
+    std::lock_guard<std::mutex> guard(job.Owner->Lock);
+    if (!--job.Owner->Remaining)
+        job.Owner->Condition.notify_all();
+}
+
+void MapRegionUpdater::WorkerThread()
+{
+    LoginDatabase.WarnAboutSyncQueries(true);
+    CharacterDatabase.WarnAboutSyncQueries(true);
+    WorldDatabase.WarnAboutSyncQueries(true);
+
+    while (1)
+    {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> guard(_queueLock);
+            _queueCondition.wait(guard, [this] { return !_queue.empty() || _cancelationToken; });
+
+            if (_cancelationToken)
+                return;
+
+            job = std::move(_queue.front());
+            _queue.pop_front();
+        }
+
+        RunJob(job);
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAP_REGION_UPDATER_H_INCLUDED
+#define _MAP_REGION_UPDATER_H_INCLUDED
+
+#include "Define.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class Creature;
+class DynamicObject;
+class GameObject;
+class Map;
+class Object;
+class Unit;
+class WorldObject;
+
+// Cells marked for update during a tick, collected instead of visited when the map is updated by regions
+struct MapRegionCells
+{
+    std::vector<uint32> Cells;
+    std::vector<uint32> LargeCells;
+
+    void Clear()
+    {
+        Cells.clear();
+        LargeCells.clear();
+    }
+};
+
+// Side effects a region update would normally write into shared Map containers.
+// They are buffered per region and merged in region order once all regions are done.
+struct MapRegionUpdateContext
+{
+    std::vector<Creature*> CreaturesToMove;
+    std::vector<GameObject*> GameObjectsToMove;
+    std::vector<DynamicObject*> DynamicObjectsToMove;
+    std::vector<Unit*> DelayedVisibility;
+    std::vector<std::pair<Object*, bool /*add*/>> UpdateObjects;
+    // objects whose update may reach beyond the region, updated serially after the parallel phase
+    std::vector<WorldObject*> Deferred;
+
+    void Clear();
+};
+
+/*
+ * Intra-map parallelism for base maps (MapUpdate.Regions.Enable).
+ *
+ * The loaded part of a continent is split into square regions of
+ * MapUpdate.Regions.GridsPerRegion grids. Cells closer than the halo to a
+ * region border belong to no region: they are updated serially after the
+ * parallel phase. The halo is derived from REGION_UPDATE_REACH, the largest
+ * visibility and searcher radius, plus one cell for cell rounding and
+ * movement during the tick. Objects updated at the same time are therefore
+ * more than two reaches apart and can not touch the same object or grid cell.
+ *
+ * Effects that are not bounded by that radius (threat and combat references,
+ * owners and charmers, vehicles, scripted active objects, dynamic objects of
+ * their caster, respawn times and pools of dead or despawned objects) are not
+ * run in parallel: such objects are collected per region and updated serially
+ * once all regions are done. The few map-wide containers still reached from a
+ * region (respawn times, script schedule) take the map's region update lock,
+ * and scripts started in a region only run with the scripts of the map update.
+ */
+class MapRegionUpdater
+{
+public:
+    MapRegionUpdater();
+    ~MapRegionUpdater();
+
+    void Activate(std::size_t numThreads, uint32 gridsPerRegion);
+    void Deactivate();
+    [[nodiscard]] bool IsActive() const { return !_workerThreads.empty(); }
+
+    void UpdateCells(Map& map, MapRegionCells const& cells, uint32 diff);
+
+    // context of the region being updated by the calling thread, nullptr outside of the parallel phase
+    static MapRegionUpdateContext*& CurrentContext()
+    {
+        static thread_local MapRegionUpdateContext* context = nullptr;
+        return context;
+    }
+
+    // true if the update of the object may change state outside of its region
+    static bool MustUpdateSerially(WorldObject const* object);
+
+private:
+    struct Region
+    {
+        uint32 Id;
+        std::vector<uint32> Cells;
+        std::vector<uint32> LargeCells;
+        MapRegionUpdateContext Context;
+    };
+
+    struct Batch
+    {
+        std::mutex Lock;
+        std::condition_variable Condition;
+        std::size_t Remaining = 0;
+    };
+
+    struct Job
+    {
+        std::function<void()> Task;
+        Batch* Owner;
+    };
+
+    void WorkerThread();
+    bool RunPendingJob();
+    void RunJob(Job& job);
+
+    template<class UPDATER>
+    static void VisitCells(Map& map, std::vector<uint32> const& cells, std::vector<uint32> const& largeCells, uint32 diff);
+
+    uint32 _cellsPerRegion;
+    uint32 _haloCells;
+
+    std::vector<std::thread> _workerThreads;
+    std::atomic<bool> _cancelationToken;
+
+    std::mutex _queueLock;
+    std::condition_variable _queueCondition;
+    std::deque<Job> _queue;
+};
+
+#endif //_MAP_REGION_UPDATER_H_INCLUDED
@@ -20,6 +20,7 @@
 #include "LFGMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include <algorithm>
 
 class UpdateRequest
 {
@@ -28,25 +29,50 @@ public:
     virtual ~UpdateRequest() = default;
 
     virtual void call() = 0;
+
+    // estimated cost in microseconds, used to order the worker queues
+    [[nodiscard]] virtual uint64 GetCost() const = 0;
 };
 
 class MapUpdateRequest : public UpdateRequest
 {
 public:
     MapUpdateRequest(Map& m, MapUpdater& u, uint32 d, uint32 sd)
-        : m_map(m), m_updater(u), m_diff(d), s_diff(sd)
+        : m_map(&m), m_updater(u), m_diff(d), s_diff(sd)
+    {
+    }
+
+    void Reset(Map& m, uint32 d, uint32 sd)
     {
+        m_map = &m;
+        m_diff = d;
+        s_diff = sd;
     }
 
     void call() override
     {
-        METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-        m_map.Update(m_diff, s_diff);
-        m_updater.update_finished();
+        Map& map = *m_map;
+        MapUpdater& updater = m_updater;
+
+        {
+            METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(map.GetId())));
+            TimePoint start = std::chrono::steady_clock::now();
+            map.Update(m_diff, s_diff);
+            map.SetLastUpdateCost(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start));
+        }
+
+        // this object may be reused as soon as it is back in the pool, do not touch members afterwards
+        updater.ReleaseRequest(this);
+        updater.update_finished();
+    }
+
+    [[nodiscard]] uint64 GetCost() const override
+    {
+        return uint64(m_map->GetLastUpdateCost().count());
     }
 
 private:
-    Map& m_map;
+    Map* m_map;
     MapUpdater& m_updater;
     uint32 m_diff;
     uint32 s_diff;
@@ -55,38 +81,60 @@ private:
 class LFGUpdateRequest : public UpdateRequest
 {
 public:
-    LFGUpdateRequest(MapUpdater& u, uint32 d) : m_updater(u), m_diff(d) {}
+    LFGUpdateRequest(MapUpdater& u) : m_updater(u), m_diff(0), m_cost(0) {}
+
+    void SetDiff(uint32 d) { m_diff = d; }
 
     void call() override
     {
+        TimePoint start = std::chrono::steady_clock::now();
         sLFGMgr->Update(m_diff, 1);
+        m_cost = uint64(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start).count());
         m_updater.update_finished();
     }
+
+    [[nodiscard]] uint64 GetCost() const override { return m_cost; }
+
 private:
     MapUpdater& m_updater;
     uint32 m_diff;
+    uint64 m_cost;
 };
 
-MapUpdater::MapUpdater(): pending_requests(0)
+MapUpdater::MapUpdater() : _cancelationToken(false), _queuedRequests(0), pending_requests(0),
+    _lfgRequest(std::make_unique<LFGUpdateRequest>(*this))
+{
+}
+
+MapUpdater::~MapUpdater()
 {
+    for (MapUpdateRequest* request : _requestPool)
+        delete request;
 }
 
 void MapUpdater::activate(std::size_t num_threads)
 {
+    _workers.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i)
+        _workers.push_back(std::make_unique<Worker>());
+
     _workerThreads.reserve(num_threads);
     for (std::size_t i = 0; i < num_threads; ++i)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, i));
     }
 }
 
 void MapUpdater::deactivate()
 {
-    _cancelationToken = true;
-
     wait();
 
-    _queue.Cancel();
+    {
+        std::lock_guard<std::mutex> guard(_wakeLock);
+        _cancelationToken = true;
+    }
+
+    _wakeCondition.notify_all();
 
     for (auto& thread : _workerThreads)
     {
@@ -105,24 +153,29 @@ void MapUpdater::wait()
         _condition.wait(guard);
 
     guard.unlock();
+
+    LogWorkerStatistics();
 }
 
 void MapUpdater::schedule_update(Map& map, uint32 diff, uint32 s_diff)
 {
-    std::lock_guard<std::mutex> guard(_lock);
-
-    ++pending_requests;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        ++pending_requests;
+    }
 
-    _queue.Push(new MapUpdateRequest(map, *this, diff, s_diff));
+    Enqueue(AcquireRequest(map, diff, s_diff));
 }
 
 void MapUpdater::schedule_lfg_update(uint32 diff)
 {
-    std::lock_guard<std::mutex> guard(_lock);
-
-    ++pending_requests;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        ++pending_requests;
+    }
 
-    _queue.Push(new LFGUpdateRequest(*this, diff));
+    _lfgRequest->SetDiff(diff);
+    Enqueue(_lfgRequest.get());
 }
 
 bool MapUpdater::activated()
@@ -139,22 +192,146 @@ void MapUpdater::update_finished()
     _condition.notify_all();
 }
 
-void MapUpdater::WorkerThread()
+MapUpdateRequest* MapUpdater::AcquireRequest(Map& map, uint32 diff, uint32 s_diff)
+{
+    {
+        std::lock_guard<std::mutex> guard(_poolLock);
+        if (!_requestPool.empty())
+        {
+            MapUpdateRequest* request = _requestPool.back();
+            _requestPool.pop_back();
+            request->Reset(map, diff, s_diff);
+            return request;
+        }
+    }
+
+    return new MapUpdateRequest(map, *this, diff, s_diff);
+}
+
+void MapUpdater::ReleaseRequest(MapUpdateRequest* request)
+{
+    std::lock_guard<std::mutex> guard(_poolLock);
+    _requestPool.push_back(request);
+}
+
+void MapUpdater::Enqueue(UpdateRequest* request)
+{
+    uint64 cost = request->GetCost();
+
+    // place the request on the worker with the least amount of queued work
+    Worker* target = _workers.front().get();
+    for (auto const& worker : _workers)
+        if (worker->QueuedCost < target->QueuedCost)
+            target = worker.get();
+
+    {
+        std::lock_guard<std::mutex> guard(target->Lock);
+
+        // keep the queue sorted by descending cost, queues are short so a linear search is fine
+        auto itr = std::find_if(target->Queue.begin(), target->Queue.end(), [cost](UpdateRequest const* queued)
+        {
+            return queued->GetCost() < cost;
+        });
+
+        target->Queue.insert(itr, request);
+        target->QueuedCost += cost;
+        ++_queuedRequests;
+    }
+
+    // pass through the wake lock so a worker that is about to sleep cannot miss the notification
+    {
+        std::lock_guard<std::mutex> guard(_wakeLock);
+    }
+
+    _wakeCondition.notify_one();
+}
+
+UpdateRequest* MapUpdater::PopOwn(Worker& worker)
+{
+    std::lock_guard<std::mutex> guard(worker.Lock);
+    if (worker.Queue.empty())
+        return nullptr;
+
+    UpdateRequest* request = worker.Queue.front();
+    worker.Queue.pop_front();
+    worker.QueuedCost -= std::min<uint64>(worker.QueuedCost, request->GetCost());
+    --_queuedRequests;
+    return request;
+}
+
+UpdateRequest* MapUpdater::Steal(std::size_t thiefIndex)
+{
+    for (std::size_t i = 1; i < _workers.size(); ++i)
+    {
+        Worker& victim = *_workers[(thiefIndex + i) % _workers.size()];
+
+        std::lock_guard<std::mutex> guard(victim.Lock);
+        if (victim.Queue.empty())
+            continue;
+
+        // take the cheapest request, the owner keeps working on the expensive ones
+        UpdateRequest* request = victim.Queue.back();
+        victim.Queue.pop_back();
+        victim.QueuedCost -= std::min<uint64>(victim.QueuedCost, request->GetCost());
+        --_queuedRequests;
+        return request;
+    }
+
+    return nullptr;
+}
+
+void MapUpdater::LogWorkerStatistics()
+{
+    if (!sMetric->IsEnabled())
+        return;
+
+    for (std::size_t i = 0; i < _workers.size(); ++i)
+    {
+        Worker& worker = *_workers[i];
+        std::string workerTag = std::to_string(i);
+
+        METRIC_VALUE("map_updater_idle_time", worker.IdleTime.exchange(0), METRIC_TAG("worker", workerTag));
+        METRIC_VALUE("map_updater_steals", worker.Steals.exchange(0), METRIC_TAG("worker", workerTag));
+        METRIC_VALUE("map_updater_executed", worker.Executed.exchange(0), METRIC_TAG("worker", workerTag));
+    }
+}
+
+void MapUpdater::WorkerThread(std::size_t workerIndex)
 {
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
 
+    Worker& worker = *_workers[workerIndex];
+
     while (1)
     {
-        UpdateRequest* request = nullptr;
+        UpdateRequest* request = PopOwn(worker);
+        if (!request)
+        {
+            request = Steal(workerIndex);
+            if (request)
+                ++worker.Steals;
+        }
 
-        _queue.WaitAndPop(request);
-        if (_cancelationToken)
-            return;
+        if (!request)
+        {
+            TimePoint idleStart = std::chrono::steady_clock::now();
 
-        request->call();
+            {
+                std::unique_lock<std::mutex> guard(_wakeLock);
+                _wakeCondition.wait(guard, [this] { return _queuedRequests > 0 || _cancelationToken; });
+            }
 
-        delete request;
+            worker.IdleTime += uint64(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - idleStart).count());
+
+            if (_cancelationToken)
+                return;
+
+            continue;
+        }
+
+        request->call();
+        ++worker.Executed;
     }
 }
@@ -19,19 +19,35 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
-#include "PCQueue.h"
+#include "Duration.h"
+#include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 class Map;
 class UpdateRequest;
+class MapUpdateRequest;
+class LFGUpdateRequest;
 
+/*
+ * Work-stealing scheduler for map updates.
+ *
+ * Every worker owns a deque of requests kept sorted by the cost the map had
+ * on its previous update (most expensive first). New requests are placed on
+ * the worker with the lowest queued cost, workers drain their own deque from
+ * the front and, once it is empty, steal the cheapest entries from the back
+ * of other workers' deques. This makes the big continents start first
+ * instead of being picked up last by whichever thread happens to be free.
+ */
 class MapUpdater
 {
 public:
     MapUpdater();
-    ~MapUpdater() = default;
+    ~MapUpdater();
 
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_lfg_update(uint32 diff);
@@ -41,17 +57,46 @@ public:
     bool activated();
     void update_finished();
 
+    void ReleaseRequest(MapUpdateRequest* request);
+
 private:
-    void WorkerThread();
+    struct Worker
+    {
+        std::mutex Lock;
+        std::deque<UpdateRequest*> Queue;
+        std::atomic<uint64> QueuedCost{0};
 
-    ProducerConsumerQueue<UpdateRequest*> _queue;
+        // statistics, reset every time they are sent to sMetric
+        std::atomic<uint64> IdleTime{0};
+        std::atomic<uint32> Steals{0};
+        std::atomic<uint32> Executed{0};
+    };
 
+    void WorkerThread(std::size_t workerIndex);
+
+    void Enqueue(UpdateRequest* request);
+    UpdateRequest* PopOwn(Worker& worker);
+    UpdateRequest* Steal(std::size_t thiefIndex);
+    MapUpdateRequest* AcquireRequest(Map& map, uint32 diff, uint32 s_diff);
+    void LogWorkerStatistics();
+
+    std::vector<std::unique_ptr<Worker>> _workers;
     std::vector<std::thread> _workerThreads;
     std::atomic<bool> _cancelationToken;
 
+    // sleeping workers wait here until a request is queued anywhere
+    std::mutex _wakeLock;
+    std::condition_variable _wakeCondition;
+    std::atomic<std::size_t> _queuedRequests;
+
     std::mutex _lock;
     std::condition_variable _condition;
     std::size_t pending_requests;
+
+    // MapUpdateRequest objects are recycled between ticks
+    std::mutex _poolLock;
+    std::vector<MapUpdateRequest*> _requestPool;
+    std::unique_ptr<LFGUpdateRequest> _lfgRequest;
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
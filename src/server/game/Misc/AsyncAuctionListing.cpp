@@ -17,15 +17,22 @@
 
 #include "AsyncAuctionListing.h"
 #include "Creature.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "Opcodes.h"
 #include "Player.h"
 #include "SpellAuraEffects.h"
 
-Milliseconds AsyncAuctionListingMgr::auctionListingDiff = Milliseconds::zero();
-std::list<AuctionListItemsDelayEvent> AsyncAuctionListingMgr::auctionListingList;
-std::list<AuctionListItemsDelayEvent> AsyncAuctionListingMgr::auctionListingListTemp;
-std::mutex AsyncAuctionListingMgr::auctionListingTempLock;
+std::vector<std::thread> AsyncAuctionListingMgr::workerThreads;
+bool AsyncAuctionListingMgr::shutdown = false;
+std::size_t AsyncAuctionListingMgr::maxQueuedEvents = 0;
+std::mutex AsyncAuctionListingMgr::queueLock;
+std::condition_variable AsyncAuctionListingMgr::queueCondition;
+AsyncAuctionListingMgr::EventQueue AsyncAuctionListingMgr::queuedEvents;
+std::unordered_map<ObjectGuid, AsyncAuctionListingMgr::EventQueue::iterator> AsyncAuctionListingMgr::queuedEventsByPlayer;
+GuidUnorderedSet AsyncAuctionListingMgr::runningSearches;
 
 bool AuctionListOwnerItemsDelayEvent::Execute(uint64  /*e_time*/, uint32  /*p_time*/)
 {
@@ -74,3 +81,120 @@ bool AuctionListItemsDelayEvent::Execute()
 
     return true;
 }
+
+void AsyncAuctionListingMgr::Initialize(std::size_t numThreads, std::size_t maxQueueSize)
+{
+    LOG_INFO("server", "Starting up Auction House Listing service with {} thread(s)...", numThreads);
+
+    shutdown = false;
+    maxQueuedEvents = maxQueueSize;
+
+    workerThreads.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i)
+        workerThreads.emplace_back(&AsyncAuctionListingMgr::WorkerThread);
+}
+
+void AsyncAuctionListingMgr::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+        shutdown = true;
+    }
+
+    queueCondition.notify_all();
+
+    for (std::thread& thread : workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    workerThreads.clear();
+    queuedEvents.clear();
+    queuedEventsByPlayer.clear();
+    runningSearches.clear();
+
+    LOG_INFO("server", "Auction House Listing service exiting without problems.");
+}
+
+bool AsyncAuctionListingMgr::Enqueue(AuctionListItemsDelayEvent&& delayEvent)
+{
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+
+        // a new search from the same player supersedes the pending one
+        auto itr = queuedEventsByPlayer.find(delayEvent._playerguid);
+        if (itr != queuedEventsByPlayer.end())
+        {
+            queuedEvents.erase(itr->second);
+            queuedEventsByPlayer.erase(itr);
+        }
+        else if (maxQueuedEvents && queuedEvents.size() >= maxQueuedEvents)
+        {
+            LOG_DEBUG("auctionHouse", "AsyncAuctionListingMgr: search queue is full, dropping search of {}", delayEvent._playerguid.ToString());
+            return false;
+        }
+
+        ObjectGuid playerGuid = delayEvent._playerguid;
+        TimePoint pickupTime = delayEvent._pickupTime;
+        queuedEventsByPlayer[playerGuid] = queuedEvents.emplace(pickupTime, std::move(delayEvent));
+    }
+
+    queueCondition.notify_one();
+    return true;
+}
+
+std::size_t AsyncAuctionListingMgr::GetQueueSize()
+{
+    std::lock_guard<std::mutex> guard(queueLock);
+    return queuedEvents.size();
+}
+
+void AsyncAuctionListingMgr::WorkerThread()
+{
+    CharacterDatabase.WarnAboutSyncQueries(true);
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> guard(queueLock);
+
+        if (shutdown)
+            return;
+
+        // events are ordered by pickup time, take the first due one whose player has no search running
+        TimePoint now = std::chrono::steady_clock::now();
+        EventQueue::iterator itr = queuedEvents.begin();
+        while (itr != queuedEvents.end() && itr->first <= now && runningSearches.count(itr->second._playerguid))
+            ++itr;
+
+        // nothing left, or only held searches: wait for something new or a running search to finish
+        if (itr == queuedEvents.end())
+        {
+            queueCondition.wait(guard);
+            continue;
+        }
+
+        // sleep until the next one is due
+        if (itr->first > now)
+        {
+            queueCondition.wait_until(guard, itr->first);
+            continue;
+        }
+
+        AuctionListItemsDelayEvent delayEvent = std::move(itr->second);
+        queuedEventsByPlayer.erase(delayEvent._playerguid);
+        queuedEvents.erase(itr);
+        runningSearches.insert(delayEvent._playerguid);
+
+        guard.unlock();
+
+        delayEvent.Execute();
+
+        guard.lock();
+        runningSearches.erase(delayEvent._playerguid);
+        guard.unlock();
+
+        // a newer search of the player may be held
+        queueCondition.notify_all();
+
+        METRIC_VALUE("auction_search_latency", std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - delayEvent._pickupTime));
+    }
+}
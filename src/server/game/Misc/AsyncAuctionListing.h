@@ -19,8 +19,14 @@
 #define __ASYNCAUCTIONLISTING_H
 
 #include "AuctionHouseMgr.h"
+#include "Duration.h"
 
+#include <condition_variable>
+#include <map>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 class AuctionListOwnerItemsDelayEvent : public BasicEvent
 {
@@ -41,12 +47,14 @@ class AuctionListItemsDelayEvent
 public:
     AuctionListItemsDelayEvent(Milliseconds pickupTimer, ObjectGuid playerguid, ObjectGuid creatureguid, std::string searchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax,
         uint8 usable, uint32 auctionSlotID, uint32 auctionMainCategory, uint32 auctionSubCategory, uint32 quality, uint8 getAll, AuctionSortOrderVector sortOrder) :
-        _pickupTimer(pickupTimer), _playerguid(playerguid), _creatureguid(creatureguid), _searchedname(searchedname), _listfrom(listfrom), _levelmin(levelmin), _levelmax(levelmax),_usable(usable),
-        _auctionSlotID(auctionSlotID), _auctionMainCategory(auctionMainCategory), _auctionSubCategory(auctionSubCategory), _quality(quality), _getAll(getAll), _sortOrder(sortOrder) { }
+        _queuedTime(std::chrono::steady_clock::now()), _pickupTime(_queuedTime + pickupTimer), _playerguid(playerguid), _creatureguid(creatureguid), _searchedname(searchedname),
+        _listfrom(listfrom), _levelmin(levelmin), _levelmax(levelmax),_usable(usable), _auctionSlotID(auctionSlotID), _auctionMainCategory(auctionMainCategory),
+        _auctionSubCategory(auctionSubCategory), _quality(quality), _getAll(getAll), _sortOrder(sortOrder) { }
 
     bool Execute();
 
-    Milliseconds _pickupTimer;
+    TimePoint _queuedTime;
+    TimePoint _pickupTime;
     ObjectGuid _playerguid;
     ObjectGuid _creatureguid;
     std::string _searchedname;
@@ -62,21 +70,39 @@ public:
     AuctionSortOrderVector _sortOrder;
 };
 
+/*
+ * Auction house search service.
+ *
+ * Searches are queued by the session handlers and executed by a pool of
+ * workers once their pickup time (client search throttle) is reached.
+ * A player has at most one pending search, a newer one replaces it, and at
+ * most one running search: a search is held until the previous one of the
+ * same player is done, so results reach the client in order.
+ */
 class AsyncAuctionListingMgr
 {
 public:
-    static void Update(Milliseconds diff) { auctionListingDiff += diff; }
-    static Milliseconds GetDiff() { return auctionListingDiff; }
-    static void ResetDiff() { auctionListingDiff = Milliseconds::zero(); }
-    static std::list<AuctionListItemsDelayEvent>& GetList() { return auctionListingList; }
-    static std::list<AuctionListItemsDelayEvent>& GetTempList() { return auctionListingListTemp; }
-    static std::mutex& GetTempLock() { return auctionListingTempLock; }
+    static void Initialize(std::size_t numThreads, std::size_t maxQueueSize);
+    static void Shutdown();
+
+    // returns false if the queue is full and the search was dropped
+    static bool Enqueue(AuctionListItemsDelayEvent&& delayEvent);
+    static std::size_t GetQueueSize();
 
 private:
-    static Milliseconds auctionListingDiff;
-    static std::list<AuctionListItemsDelayEvent> auctionListingList;
-    static std::list<AuctionListItemsDelayEvent> auctionListingListTemp;
-    static std::mutex auctionListingTempLock;
+    typedef std::multimap<TimePoint, AuctionListItemsDelayEvent> EventQueue;
+
+    static void WorkerThread();
+
+    static std::vector<std::thread> workerThreads;
+    static bool shutdown;
+    static std::size_t maxQueuedEvents;
+
+    static std::mutex queueLock;
+    static std::condition_variable queueCondition;
+    static EventQueue queuedEvents;
+    static std::unordered_map<ObjectGuid, EventQueue::iterator> queuedEventsByPlayer;
+    static GuidUnorderedSet runningSearches;
 };
 
 #endif
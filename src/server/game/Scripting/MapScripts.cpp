@@ -19,6 +19,7 @@
 #include "GameTime.h"
 #include "GridNotifiers.h"
 #include "Map.h"
+#include "MapRegionUpdater.h"
 #include "MapMgr.h"
 #include "MapRefMgr.h"
 #include "ObjectMgr.h"
@@ -42,6 +43,8 @@ void Map::ScriptsStart(ScriptMapMap const& scripts, uint32 id, Object* source, O
     ObjectGuid targetGUID = target ? target->GetGUID() : ObjectGuid::Empty;
     ObjectGuid ownerGUID  = (source && source->GetTypeId() == TYPEID_ITEM) ? ((Item*)source)->GetOwnerGUID() : ObjectGuid::Empty;
 
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
+
     ///- Schedule script execution for all scripts in the script map
     ScriptMap const* s2 = &(s->second);
     bool immedScript = false;
@@ -60,7 +63,8 @@ void Map::ScriptsStart(ScriptMapMap const& scripts, uint32 id, Object* source, O
         sScriptMgr->IncreaseScheduledScriptsCount();
     }
     ///- If one of the effects should be immediate, launch the script execution
-    if (/*start &&*/ immedScript && !i_scriptLock)
+    ///- (map regions updated in parallel leave it to the script processing of this map update)
+    if (/*start &&*/ immedScript && !i_scriptLock && !MapRegionUpdater::CurrentContext())
     {
         i_scriptLock = true;
         ScriptsProcess();
@@ -83,12 +87,14 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
     sa.ownerGUID  = ownerGUID;
 
     sa.script = &script;
+
+    std::unique_lock<std::recursive_mutex> regionGuard = AcquireRegionUpdateLock();
     m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(GameTime::GetGameTime().count() + delay), sa));
 
     sScriptMgr->IncreaseScheduledScriptsCount();
 
     ///- If effects should be immediate, launch the script execution
-    if (delay == 0 && !i_scriptLock)
+    if (delay == 0 && !i_scriptLock && !MapRegionUpdater::CurrentContext())
     {
         i_scriptLock = true;
         ScriptsProcess();
@@ -160,6 +160,7 @@ public: /* ServerScript */
     void OnSocketClose(std::shared_ptr<WorldSocket> socket);
     bool CanPacketReceive(WorldSession* session, WorldPacket const& packet);
     bool CanPacketSend(WorldSession* session, WorldPacket const& packet);
+    bool HasPacketSendHooks();
 
 public: /* WorldScript */
     void OnLoadCustomDatabaseTable();
@@ -0,0 +1,142 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SharedWorldPacket.h"
+#include "Log.h"
+#include "World.h"
+#include "zlib.h"
+#include <vector>
+
+namespace
+{
+    // Keeps one zlib deflate stream and output buffer per network thread. deflateInit allocates
+    // ~256 KB of state, deflateReset only clears it, so reusing the stream is much cheaper.
+    class PacketCompressor
+    {
+    public:
+        PacketCompressor() : _initialized(false), _level(0)
+        {
+            _stream.zalloc = (alloc_func)0;
+            _stream.zfree = (free_func)0;
+            _stream.opaque = (voidpf)0;
+        }
+
+        ~PacketCompressor()
+        {
+            if (_initialized)
+                deflateEnd(&_stream);
+        }
+
+        PacketCompressor(PacketCompressor const&) = delete;
+        PacketCompressor& operator=(PacketCompressor const&) = delete;
+
+        static PacketCompressor& Instance()
+        {
+            static thread_local PacketCompressor compressor;
+            return compressor;
+        }
+
+        // Returns the compressed data (prefixed with the uncompressed size) or an empty buffer on failure,
+        // the buffer stays valid until the next call from the same thread
+        std::vector<uint8> const& Compress(uint8 const* src, uint32 srcSize)
+        {
+            _buffer.clear();
+
+            if (!Prepare())
+                return _buffer;
+
+            uLong destSize = deflateBound(&_stream, srcSize);
+            _buffer.resize(destSize + sizeof(uint32));
+            std::memcpy(_buffer.data(), &srcSize, sizeof(uint32));
+            EndianConvert(*reinterpret_cast<uint32*>(_buffer.data()));
+
+            _stream.next_out = (Bytef*)(_buffer.data() + sizeof(uint32));
+            _stream.avail_out = (uInt)destSize;
+            _stream.next_in = (Bytef*)src;
+            _stream.avail_in = (uInt)srcSize;
+
+            int z_res = deflate(&_stream, Z_FINISH);
+            if (z_res != Z_STREAM_END)
+            {
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
+                _buffer.clear();
+                return _buffer;
+            }
+
+            _buffer.resize(_stream.total_out + sizeof(uint32));
+            return _buffer;
+        }
+
+    private:
+        bool Prepare()
+        {
+            // default Z_BEST_SPEED (1)
+            int level = sWorld->getIntConfig(CONFIG_COMPRESSION);
+
+            if (_initialized && _level == level)
+            {
+                int z_res = deflateReset(&_stream);
+                if (z_res == Z_OK)
+                    return true;
+
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateReset) Error code: {} ({})", z_res, zError(z_res));
+            }
+
+            if (_initialized)
+            {
+                deflateEnd(&_stream);
+                _initialized = false;
+            }
+
+            int z_res = deflateInit(&_stream, level);
+            if (z_res != Z_OK)
+            {
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
+                return false;
+            }
+
+            _initialized = true;
+            _level = level;
+            return true;
+        }
+
+        z_stream _stream;
+        bool _initialized;
+        int _level;
+        std::vector<uint8> _buffer;
+    };
+}
+
+WorldPacket const& SharedWorldPacket::GetWirePacket() const
+{
+    if (!NeedsCompression())
+        return _packet;
+
+    std::call_once(_compressOnce, &SharedWorldPacket::Compress, this);
+    return _compressed ? _compressedPacket : _packet;
+}
+
+void SharedWorldPacket::Compress() const
+{
+    std::vector<uint8> const& compressed = PacketCompressor::Instance().Compress(_packet.contents(), _packet.size());
+    if (compressed.empty())
+        return;
+
+    _compressedPacket.Initialize(SMSG_COMPRESSED_UPDATE_OBJECT, compressed.size());
+    _compressedPacket.append(compressed.data(), compressed.size());
+    _compressed = true;
+}
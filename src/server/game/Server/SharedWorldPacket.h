@@ -0,0 +1,61 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SHAREDWORLDPACKET_H_
+#define _SHAREDWORLDPACKET_H_
+
+#include "WorldPacket.h"
+#include <memory>
+#include <mutex>
+
+/**
+ * Immutable packet payload shared by every socket it is sent to.
+ *
+ * Broadcasts (SendMessageToSet, group/map/battleground wide messages) build one of these and
+ * hand the same reference to all recipients. The payload is copied once and, if it is a large
+ * SMSG_UPDATE_OBJECT, compressed once by the first network thread that writes it out; each
+ * socket only encrypts its own header.
+ */
+class AC_GAME_API SharedWorldPacket
+{
+public:
+    explicit SharedWorldPacket(WorldPacket const& packet) : _packet(packet) { }
+    explicit SharedWorldPacket(WorldPacket&& packet) : _packet(std::move(packet)) { }
+
+    SharedWorldPacket(SharedWorldPacket const&) = delete;
+    SharedWorldPacket& operator=(SharedWorldPacket const&) = delete;
+
+    /// Packet as built by the game code, never modified after construction
+    [[nodiscard]] WorldPacket const& GetPacket() const { return _packet; }
+
+    /// Packet as it must be written to the socket, compressed on first call if needed (thread safe)
+    [[nodiscard]] WorldPacket const& GetWirePacket() const;
+
+private:
+    [[nodiscard]] bool NeedsCompression() const { return _packet.GetOpcode() == SMSG_UPDATE_OBJECT && _packet.size() > 100; }
+
+    void Compress() const;
+
+    WorldPacket _packet;
+    mutable WorldPacket _compressedPacket;
+    mutable std::once_flag _compressOnce;
+    mutable bool _compressed{false};
+};
+
+typedef std::shared_ptr<SharedWorldPacket const> SharedWorldPacketPtr;
+
+#endif
@@ -47,6 +47,7 @@
 #include "Transport.h"
 #include "Vehicle.h"
 #include "WardenWin.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSocket.h"
@@ -260,6 +261,19 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     m_Socket->SendPacket(*packet);
 }
 
+void WorldSession::SendSharedPacket(SharedWorldPacketPtr const& packet)
+{
+    if (!m_Socket)
+        return;
+
+    if (!sScriptMgr->CanPacketSend(this, packet->GetPacket()))
+    {
+        return;
+    }
+
+    m_Socket->SendPacket(packet);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -705,6 +719,7 @@ void WorldSession::LogoutPlayer(bool save)
         //! Broadcast a logout message to the player's friends
         sSocialMgr->SendFriendStatus(_player, FRIEND_OFFLINE, _player->GetGUID(), true);
         sSocialMgr->RemovePlayerSocial(_player->GetGUID());
+        sWhoListCacheMgr->RemovePlayer(_player->GetGUID());
 
         //! Call script hook before deletion
         sScriptMgr->OnPlayerLogout(_player);
@@ -31,6 +31,7 @@
 #include "GossipDef.h"
 #include "Packet.h"
 #include "SharedDefines.h"
+#include "SharedWorldPacket.h"
 #include "World.h"
 #include <map>
 #include <memory>
@@ -363,6 +364,10 @@ public:
     }
 
     void SendPacket(WorldPacket const* packet);
+    /// Sends a payload shared with other recipients, see SharedWorldPacket
+    void SendSharedPacket(SharedWorldPacketPtr const& packet);
+    /// Socket of the session, null once the connection has been dropped
+    std::shared_ptr<WorldSocket> const& GetSocket() const { return m_Socket; }
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
     void SendAreaTriggerMessage(const char* Text, ...) ATTR_PRINTF(2, 3);
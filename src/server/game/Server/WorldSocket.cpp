@@ -30,88 +30,12 @@
 #include "ScriptMgr.h"
 #include "World.h"
 #include "WorldSession.h"
-#include "zlib.h"
 #include <memory>
 
 using boost::asio::ip::tcp;
 
-void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
-{
-    z_stream c_stream;
-
-    c_stream.zalloc = (alloc_func)0;
-    c_stream.zfree = (free_func)0;
-    c_stream.opaque = (voidpf)0;
-
-    // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld->getIntConfig(CONFIG_COMPRESSION));
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    c_stream.next_out = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in = (Bytef*)src;
-    c_stream.avail_in = (uInt)src_size;
-
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    if (c_stream.avail_in != 0)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate not greedy)");
-        *dst_size = 0;
-        return;
-    }
-
-    z_res = deflate(&c_stream, Z_FINISH);
-    if (z_res != Z_STREAM_END)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateEnd) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    *dst_size = c_stream.total_out;
-}
-
-void EncryptableAndCompressiblePacket::CompressIfNeeded()
-{
-    if (!NeedsCompression())
-        return;
-
-    uint32 pSize = size();
-
-    uint32 destsize = compressBound(pSize);
-    ByteBuffer buf(destsize + sizeof(uint32));
-    buf.resize(destsize + sizeof(uint32));
-
-    buf.put<uint32>(0, pSize);
-    compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32), &destsize, (void*)contents(), pSize);
-    if (destsize == 0)
-        return;
-
-    buf.resize(destsize + sizeof(uint32));
-
-    ByteBuffer::operator=(std::move(buf));
-    SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
-}
+// Payloads at least this large are written directly from the packet instead of being copied into the send buffer
+constexpr std::size_t ZERO_COPY_PAYLOAD_SIZE = 1024;
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
     : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _sendBufferSize(4096)
@@ -165,40 +89,36 @@ bool WorldSocket::Update()
     {
         // Allocate buffer only when it's needed but not on every Update() call.
         MessageBuffer buffer(_sendBufferSize);
-        std::size_t currentPacketSize;
         do
         {
-            queued->CompressIfNeeded();
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            WorldPacket const& packet = queued->GetWirePacket();
+            ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
+            // Small packets are copied together into one buffer, large payloads are queued by reference
+            // and written straight from the (possibly shared) packet, only their header is copied
+            bool copyPayload = packet.size() < ZERO_COPY_PAYLOAD_SIZE;
+            std::size_t copySize = header.getHeaderLength() + (copyPayload ? packet.size() : 0);
 
-            if (buffer.GetRemainingSpace() < currentPacketSize)
+            if (buffer.GetRemainingSpace() < copySize)
             {
-                QueuePacket(std::move(buffer));
-                buffer.Resize(_sendBufferSize);
+                if (buffer.GetActiveSize() > 0)
+                    QueuePacket(std::move(buffer));
+
+                buffer.Resize(std::max(_sendBufferSize, copySize));
             }
 
-            if (buffer.GetRemainingSpace() >= currentPacketSize)
+            buffer.Write(header.header, header.getHeaderLength());
+            if (copyPayload)
             {
-                buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!packet.empty())
+                    buffer.Write(packet.contents(), packet.size());
             }
-            else    // Single packet larger than current buffer size
+            else
             {
-                // Resize buffer to fit current packet
-                buffer.Resize(currentPacketSize);
-
-                // Grow future buffers to current packet size if still below limit
-                if (currentPacketSize <= 65536)
-                    _sendBufferSize = currentPacketSize;
-
-                buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                QueuePacket(std::move(buffer));
+                QueuePacket(queued->GetSharedPacket(), packet.contents(), packet.size());
             }
 
             delete queued;
@@ -518,7 +438,20 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     if (sPacketLog->CanLogPacket())
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
-    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(std::make_shared<SharedWorldPacket>(packet), _authCrypt.IsInitialized()));
+    ScheduleUpdate();
+}
+
+void WorldSocket::SendPacket(SharedWorldPacketPtr packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(packet->GetPacket(), SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(std::move(packet), _authCrypt.IsInitialized()));
+    ScheduleUpdate();
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "MPSCQueue.h"
 #include "ServerPktHeader.h"
+#include "SharedWorldPacket.h"
 #include "Socket.h"
 #include "Util.h"
 #include "WorldPacket.h"
@@ -30,23 +31,24 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptableAndCompressiblePacket : public WorldPacket
+class EncryptableAndCompressiblePacket
 {
 public:
-    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptableAndCompressiblePacket(SharedWorldPacketPtr packet, bool encrypt) : _packet(std::move(packet)), _encrypt(encrypt)
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
     bool NeedsEncryption() const { return _encrypt; }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    WorldPacket const& GetWirePacket() const { return _packet->GetWirePacket(); }
 
-    void CompressIfNeeded();
+    SharedWorldPacketPtr const& GetSharedPacket() const { return _packet; }
 
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
+    SharedWorldPacketPtr _packet;
     bool _encrypt;
 };
 
@@ -81,8 +83,10 @@ public:
 
     void Start() override;
     bool Update() override;
+    [[nodiscard]] bool HasPendingWork() const override { return BaseSocket::HasPendingWork() || !_queryProcessor.Empty(); }
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(SharedWorldPacketPtr packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
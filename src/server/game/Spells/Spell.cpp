@@ -51,6 +51,7 @@
 #include "UpdateMask.h"
 #include "Util.h"
 #include "VMapFactory.h"
+#include "VMapMgr2.h"
 #include "Vehicle.h"
 #include "World.h"
 #include "WorldPacket.h"
@@ -1328,6 +1329,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             Acore::Containers::RandomResize(targets, maxTargets);
         }
 
+        PrefetchEffectTargetLOS(targets);
         for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
         {
             if (Unit* unitTarget = (*itr)->ToUnit())
@@ -1335,6 +1337,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             else if (GameObject* gObjTarget = (*itr)->ToGameObject())
                 AddGOTarget(gObjTarget, effMask);
         }
+        m_prefetchedTargetLOS.clear();
     }
 }
 
@@ -2249,17 +2252,32 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
         // get unit with highest hp deficit in dist
         if (isChainHeal)
         {
-            uint32 maxHPDeficit = 0;
+            // line of sight to every unit in jump range is checked in one batch
+            std::vector<std::list<WorldObject*>::iterator> candidates;
+            std::vector<VMAP::LineOfSightSegment> segments;
             for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
             {
-                if (Unit* unit = (*itr)->ToUnit())
+                Unit* unit = (*itr)->ToUnit();
+                if (!unit || !target->IsWithinDist(unit, jumpRadius) || !target->IsInMap(unit))
+                    continue;
+
+                G3D::Vector3 from, to;
+                target->GetLOSPoints(unit, from, to);
+                segments.emplace_back(from, to);
+                candidates.push_back(itr);
+            }
+
+            target->GetMap()->isInLineOfSight(segments, target->GetPhaseMask(), LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2);
+
+            uint32 maxHPDeficit = 0;
+            for (std::size_t i = 0; i < candidates.size(); ++i)
+            {
+                Unit* unit = (*candidates[i])->ToUnit();
+                uint32 deficit = unit->GetMaxHealth() - unit->GetHealth();
+                if ((deficit > maxHPDeficit || foundItr == tempTargets.end()) && segments[i].inLineOfSight)
                 {
-                    uint32 deficit = unit->GetMaxHealth() - unit->GetHealth();
-                    if ((deficit > maxHPDeficit || foundItr == tempTargets.end()) && target->IsWithinDist(unit, jumpRadius) && target->IsWithinLOSInMap(unit, VMAP::ModelIgnoreFlags::M2))
-                    {
-                        foundItr = itr;
-                        maxHPDeficit = deficit;
-                    }
+                    foundItr = candidates[i];
+                    maxHPDeficit = deficit;
                 }
             }
         }
@@ -7979,33 +7997,22 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
         default: // normal case
         {
             uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
-            GameObject* gobCaster = nullptr;
-            if (m_originalCasterGUID.IsGameObject())
+            if (!GetEffectTargetLOSChecks(losChecks))
             {
-                gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
-            }
-            else if (m_caster->GetEntry() == WORLD_TRIGGER)
-            {
-                if (TempSummon* tempSummon = m_caster->ToTempSummon())
-                {
-                    gobCaster = tempSummon->GetSummonerGameObject();
-                }
+                return true;
             }
 
-            if (gobCaster)
+            if (target != m_caster)
             {
-                if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+                std::unordered_map<ObjectGuid, bool>::const_iterator prefetched = m_prefetchedTargetLOS.find(target->GetGUID());
+                if (prefetched != m_prefetchedTargetLOS.end())
                 {
-                    return true;
+                    if (!prefetched->second)
+                    {
+                        return false;
+                    }
                 }
-
-                // If spell casted by gameobject then ignore M2 models
-                losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
-            }
-
-            if (target != m_caster)
-            {
-                if (m_targets.HasDst())
+                else if (m_targets.HasDst())
                 {
                     float x = m_targets.GetDstPos()->GetPositionX();
                     float y = m_targets.GetDstPos()->GetPositionY();
@@ -8028,6 +8035,88 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
     return true;
 }
 
+/// Returns false if the gameobject casting the spell ignores line of sight
+bool Spell::GetEffectTargetLOSChecks(uint32& losChecks) const
+{
+    GameObject* gobCaster = nullptr;
+    if (m_originalCasterGUID.IsGameObject())
+    {
+        gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
+    }
+    else if (m_caster->GetEntry() == WORLD_TRIGGER)
+    {
+        if (TempSummon* tempSummon = m_caster->ToTempSummon())
+        {
+            gobCaster = tempSummon->GetSummonerGameObject();
+        }
+    }
+
+    if (gobCaster)
+    {
+        if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+        {
+            return false;
+        }
+
+        // If spell casted by gameobject then ignore M2 models
+        losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
+    }
+
+    return true;
+}
+
+/// Computes the line of sight checks CheckEffectTarget does for area targets in one batch.
+/// Results are only valid while these targets are added and must be cleared afterwards.
+void Spell::PrefetchEffectTargetLOS(std::list<WorldObject*> const& targets)
+{
+    m_prefetchedTargetLOS.clear();
+    if (targets.size() < 2 || m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT))
+        return;
+
+    uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
+    if (!GetEffectTargetLOSChecks(losChecks))
+        return;
+
+    Position const* dst = m_targets.HasDst() ? m_targets.GetDstPos() : nullptr;
+    std::vector<VMAP::LineOfSightSegment> segments;
+    std::vector<ObjectGuid> guids;
+    segments.reserve(targets.size());
+    guids.reserve(targets.size());
+    for (WorldObject* object : targets)
+    {
+        Unit* target = object->ToUnit();
+        if (!target || target == m_caster)
+            continue;
+
+        G3D::Vector3 from, to;
+        if (dst)
+        {
+            // the ray is cast from the target, batch only those sharing the caster's map and phase
+            if (!target->IsInWorld() || target->GetMap() != m_caster->GetMap() || target->GetPhaseMask() != m_caster->GetPhaseMask())
+                continue;
+
+            target->GetLOSPoints(dst->GetPositionX(), dst->GetPositionY(), dst->GetPositionZ(), from, to);
+        }
+        else
+        {
+            if (!m_caster->IsInMap(target))
+                continue;
+
+            m_caster->GetLOSPoints(target, from, to);
+        }
+
+        segments.emplace_back(from, to);
+        guids.push_back(target->GetGUID());
+    }
+
+    if (segments.size() < 2)
+        return;
+
+    m_caster->GetMap()->isInLineOfSight(segments, m_caster->GetPhaseMask(), LineOfSightChecks(losChecks), VMAP::ModelIgnoreFlags::M2);
+    for (std::size_t i = 0; i < segments.size(); ++i)
+        m_prefetchedTargetLOS[guids[i]] = segments[i].inLineOfSight;
+}
+
 bool Spell::IsNextMeleeSwingSpell() const
 {
     return m_spellInfo->HasAttribute(SPELL_ATTR0_ON_NEXT_SWING_NO_DAMAGE);
@@ -487,6 +487,8 @@ public:
     void WriteAmmoToPacket(WorldPacket* data);
 
     bool CheckEffectTarget(Unit const* target, uint32 eff) const;
+    bool GetEffectTargetLOSChecks(uint32& losChecks) const;
+    void PrefetchEffectTargetLOS(std::list<WorldObject*> const& targets);
     bool CanAutoCast(Unit* target);
     void CheckSrc() { if (!m_targets.HasSrc()) m_targets.SetSrc(*m_caster); }
     void CheckDst() { if (!m_targets.HasDst()) m_targets.SetDst(*m_caster); }
@@ -681,6 +683,7 @@ public:
     // *****************************************
     std::list<TargetInfo> m_UniqueTargetInfo;
     uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
+    std::unordered_map<ObjectGuid, bool> m_prefetchedTargetLOS; // LOS of the area targets being added, checked in one batch
 
     struct GOTargetInfo
     {
@@ -187,6 +187,10 @@ enum WorldBoolConfigs
     CONFIG_ALLOWS_RANK_MOD_FOR_PET_HEALTH,
     CONFIG_MUNCHING_BLIZZLIKE,
     CONFIG_ENABLE_DAZE,
+    CONFIG_MAP_UPDATE_REGIONS,
+    CONFIG_VISIBILITY_INCREMENTAL,
+    CONFIG_MEMORY_MAPPED_MAPS,
+    CONFIG_MEMORY_MAPPED_DBC,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -420,7 +424,15 @@ enum WorldIntConfigs
     CONFIG_CHANGE_FACTION_MAX_MONEY,
     CONFIG_WATER_BREATH_TIMER,
     CONFIG_AUCTION_HOUSE_SEARCH_TIMEOUT,
+    CONFIG_AUCTION_HOUSE_SEARCH_THREADS,
+    CONFIG_AUCTION_HOUSE_SEARCH_QUEUE_SIZE,
     CONFIG_DAILY_RBG_MIN_LEVEL_AP_REWARD,
+    CONFIG_MAP_UPDATE_REGIONS_THREADS,
+    CONFIG_MAP_UPDATE_REGIONS_GRIDS,
+    CONFIG_VISIBILITY_INCREMENTAL_FULL_SCAN_INTERVAL,
+    CONFIG_STARTUP_LOADER_THREADS,
+    CONFIG_CHANNEL_BROADCAST_THRESHOLD,
+    CONFIG_CHANNEL_BROADCAST_QUEUE_SIZE,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -565,6 +577,7 @@ public:
     [[nodiscard]] virtual Seconds GetNextRandomBGResetTime() const = 0;
     [[nodiscard]] virtual uint16 GetConfigMaxSkillValue() const = 0;
     virtual void SetInitialWorldSettings() = 0;
+    virtual void SetStartupProfile(bool profile) = 0;
     virtual void LoadConfigSettings(bool reload = false) = 0;
     virtual void SendGlobalMessage(WorldPacket const* packet, WorldSession* self = nullptr, TeamId teamId = TEAM_NEUTRAL) = 0;
     virtual void SendScreenMessage(const char *text, Player* player = NULL, bool GM = false, TeamId teamId = TEAM_NEUTRAL) = 0;
@@ -0,0 +1,223 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupTaskGraph.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+
+StartupTaskGraph::TaskId StartupTaskGraph::Add(std::string name, std::function<void()> function, std::vector<TaskId> dependencies)
+{
+    TaskId id = TaskId(_tasks.size());
+
+    std::sort(dependencies.begin(), dependencies.end());
+    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+    for (TaskId dependency : dependencies)
+    {
+        ASSERT(dependency < id, "Startup task {} depends on task {} which is not added yet", name, dependency);
+        _tasks[dependency].Dependents.push_back(id);
+    }
+
+    Task& task = _tasks.emplace_back();
+    task.Name = std::move(name);
+    task.Function = std::move(function);
+    task.Dependencies = std::move(dependencies);
+    return id;
+}
+
+void StartupTaskGraph::RunTask(Task& task, uint32 runStart)
+{
+    LOG_INFO("server.loading", "{}...", task.Name);
+
+    uint32 startTime = getMSTime();
+    task.Function();
+
+    task.StartTime = getMSTimeDiff(runStart, startTime);
+    task.Duration = GetMSTimeDiffToNow(startTime);
+}
+
+void StartupTaskGraph::Run(uint32 numThreads)
+{
+    _threadCount = std::max<uint32>(1, std::min<uint32>(numThreads, uint32(_tasks.size())));
+    uint32 runStart = getMSTime();
+
+    if (_threadCount == 1)
+    {
+        for (Task& task : _tasks)
+            RunTask(task, runStart);
+
+        _wallTime = GetMSTimeDiffToNow(runStart);
+        return;
+    }
+
+    std::vector<uint32> pendingDependencies(_tasks.size());
+    std::set<TaskId> ready;                 // lowest id first, stays close to the serial order
+    for (TaskId id = 0; id < _tasks.size(); ++id)
+    {
+        pendingDependencies[id] = uint32(_tasks[id].Dependencies.size());
+        if (!pendingDependencies[id])
+            ready.insert(id);
+    }
+
+    std::mutex lock;
+    std::condition_variable condition;
+    std::size_t remaining = _tasks.size();
+    std::exception_ptr failure;
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        while (true)
+        {
+            condition.wait(guard, [&]() { return !ready.empty() || !remaining || failure; });
+            if (!remaining || failure)
+                return;
+
+            TaskId id = *ready.begin();
+            ready.erase(ready.begin());
+
+            guard.unlock();
+            std::exception_ptr error;
+            try
+            {
+                RunTask(_tasks[id], runStart);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            guard.lock();
+
+            if (error)
+            {
+                failure = error;
+                condition.notify_all();
+                return;
+            }
+
+            --remaining;
+            for (TaskId dependent : _tasks[id].Dependents)
+                if (!--pendingDependencies[dependent])
+                    ready.insert(dependent);
+
+            if (!remaining || !ready.empty())
+                condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(_threadCount - 1);
+    for (uint32 i = 1; i < _threadCount; ++i)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    _wallTime = GetMSTimeDiffToNow(runStart);
+
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+std::vector<StartupTaskGraph::TaskId> StartupTaskGraph::GetCriticalPath(uint32& length) const
+{
+    // Longest chain of measured durations through the dependency edges;
+    // ids are a topological order so a single forward pass is enough
+    std::vector<uint32> finish(_tasks.size(), 0);
+    std::vector<TaskId> previous(_tasks.size(), TaskId(-1));
+    TaskId last = 0;
+    length = 0;
+
+    for (TaskId id = 0; id < _tasks.size(); ++id)
+    {
+        uint32 start = 0;
+        for (TaskId dependency : _tasks[id].Dependencies)
+        {
+            if (finish[dependency] >= start)
+            {
+                start = finish[dependency];
+                previous[id] = dependency;
+            }
+        }
+
+        finish[id] = start + _tasks[id].Duration;
+        if (finish[id] >= length)
+        {
+            length = finish[id];
+            last = id;
+        }
+    }
+
+    std::vector<TaskId> path;
+    if (_tasks.empty())
+        return path;
+
+    for (TaskId id = last; id != TaskId(-1); id = previous[id])
+        path.push_back(id);
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+void StartupTaskGraph::LogReport(bool profile) const
+{
+    uint64 totalTime = 0;
+    for (Task const& task : _tasks)
+        totalTime += task.Duration;
+
+    uint32 criticalPathLength = 0;
+    std::vector<TaskId> criticalPath = GetCriticalPath(criticalPathLength);
+
+    LOG_INFO("server.loading", " ");
+    LOG_INFO("server.loading", ">> Ran {} startup loaders on {} thread(s) in {} ms ({} ms of loader time, critical path {} ms)",
+        _tasks.size(), _threadCount, _wallTime, totalTime, criticalPathLength);
+
+    std::vector<TaskId> byDuration(_tasks.size());
+    for (TaskId id = 0; id < _tasks.size(); ++id)
+        byDuration[id] = id;
+
+    std::stable_sort(byDuration.begin(), byDuration.end(), [this](TaskId left, TaskId right)
+    {
+        return _tasks[left].Duration > _tasks[right].Duration;
+    });
+
+    std::size_t const slowestCount = profile ? byDuration.size() : std::min<std::size_t>(5, byDuration.size());
+    LOG_INFO("server.loading", ">> {} startup loaders:", profile ? "All" : "Slowest");
+    for (std::size_t i = 0; i < slowestCount; ++i)
+    {
+        Task const& task = _tasks[byDuration[i]];
+        LOG_INFO("server.loading", "   {:>7} ms  (started at {:>7} ms)  {}", task.Duration, task.StartTime, task.Name);
+    }
+
+    if (profile)
+    {
+        LOG_INFO("server.loading", ">> Startup critical path:");
+        for (TaskId id : criticalPath)
+            LOG_INFO("server.loading", "   {:>7} ms  {}", _tasks[id].Duration, _tasks[id].Name);
+    }
+
+    LOG_INFO("server.loading", " ");
+}
@@ -0,0 +1,71 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STARTUP_TASK_GRAPH_H_INCLUDED
+#define _STARTUP_TASK_GRAPH_H_INCLUDED
+
+#include "Define.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+ * Dependency graph of the world loaders run by World::SetInitialWorldSettings.
+ *
+ * A task may only depend on tasks added before it, so insertion order is
+ * always a valid topological order: with a single thread the graph runs
+ * exactly like the former straight-line sequence. With more threads
+ * (Startup.LoaderThreads) every task whose dependencies are done is handed
+ * to the next free worker, lowest id first.
+ */
+class StartupTaskGraph
+{
+public:
+    typedef uint32 TaskId;
+
+    TaskId Add(std::string name, std::function<void()> function, std::vector<TaskId> dependencies = {});
+
+    // Runs every task, blocking until all of them are done.
+    // The calling thread takes part in the work.
+    void Run(uint32 numThreads);
+
+    // Wall time, summed loader time and the slowest loaders.
+    // With profile set the full per-loader table and the critical path are logged too.
+    void LogReport(bool profile) const;
+
+    std::size_t GetTaskCount() const { return _tasks.size(); }
+
+private:
+    struct Task
+    {
+        std::string Name;
+        std::function<void()> Function;
+        std::vector<TaskId> Dependencies;
+        std::vector<TaskId> Dependents;
+        uint32 StartTime = 0;               // ms since Run() started
+        uint32 Duration = 0;
+    };
+
+    void RunTask(Task& task, uint32 runStart);
+    std::vector<TaskId> GetCriticalPath(uint32& length) const;
+
+    std::vector<Task> _tasks;
+    uint32 _threadCount = 1;
+    uint32 _wallTime = 0;
+};
+
+#endif
@@ -24,7 +24,6 @@
 #include "AchievementMgr.h"
 #include "AddonMgr.h"
 #include "ArenaTeamMgr.h"
-#include "AsyncAuctionListing.h"
 #include "AuctionHouseMgr.h"
 #include "AutobroadcastMgr.h"
 #include "BattlefieldMgr.h"
@@ -77,6 +76,7 @@
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "StartupTaskGraph.h"
 #include "TaskScheduler.h"
 #include "TicketMgr.h"
 #include "Transport.h"
@@ -90,11 +90,12 @@
 #include "WardenCheckMgr.h"
 #include "WaypointMovementGenerator.h"
 #include "WeatherMgr.h"
-#include "WhoListCacheMgr.h"
+#include "WorldDatabaseSnapshotMgr.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include <boost/asio/ip/address.hpp>
 #include <cmath>
+#include <functional>
 #include "../../scripts/Custom/Faker/Faker.h"
 namespace
 {
@@ -132,6 +133,7 @@ World::World()
     _defaultDbcLocale = LOCALE_enUS;
     _mail_expire_check_timer = 0s;
     _isClosed = false;
+    _startupProfile = false;
     _cleaningFlags = 0;
 
     memset(_rate_values, 0, sizeof(_rate_values));
@@ -935,6 +937,9 @@ void World::LoadConfigSettings(bool reload)
 
     _int_configs[CONFIG_GROUP_VISIBILITY]      = sConfigMgr->GetOption<int32>("Visibility.GroupMode", 1);
 
+    _bool_configs[CONFIG_VISIBILITY_INCREMENTAL] = sConfigMgr->GetOption<bool>("Visibility.Incremental.Enable", false);
+    _int_configs[CONFIG_VISIBILITY_INCREMENTAL_FULL_SCAN_INTERVAL] = sConfigMgr->GetOption<uint32>("Visibility.Incremental.FullScanInterval", 5000);
+
     _bool_configs[CONFIG_OBJECT_SPARKLES]      = sConfigMgr->GetOption<bool>("Visibility.ObjectSparkles", true);
 
     _bool_configs[CONFIG_LOW_LEVEL_REGEN_BOOST]      = sConfigMgr->GetOption<bool>("EnableLowLevelRegenBoost", true);
@@ -1289,6 +1294,10 @@ void World::LoadConfigSettings(bool reload)
     _int_configs[CONFIG_DAILY_RBG_MIN_LEVEL_AP_REWARD] = sConfigMgr->GetOption<uint32>("DailyRBGArenaPoints.MinLevel", 71);
 
     _int_configs[CONFIG_AUCTION_HOUSE_SEARCH_TIMEOUT] = sConfigMgr->GetOption<uint32>("AuctionHouse.SearchTimeout", 1000);
+    _int_configs[CONFIG_AUCTION_HOUSE_SEARCH_THREADS] = sConfigMgr->GetOption<uint32>("AuctionHouse.SearchThreads", 2);
+    if (_int_configs[CONFIG_AUCTION_HOUSE_SEARCH_THREADS] < 1)
+        _int_configs[CONFIG_AUCTION_HOUSE_SEARCH_THREADS] = 1;
+    _int_configs[CONFIG_AUCTION_HOUSE_SEARCH_QUEUE_SIZE] = sConfigMgr->GetOption<uint32>("AuctionHouse.SearchQueueSize", 5000);
 
     ///- Read the "Data" directory from the config file
     std::string dataPath = sConfigMgr->GetOption<std::string>("DataDir", "./");
@@ -1320,6 +1329,7 @@ void World::LoadConfigSettings(bool reload)
     bool enableLOS = sConfigMgr->GetOption<bool>("vmap.enableLOS", true);
     bool enableHeight = sConfigMgr->GetOption<bool>("vmap.enableHeight", true);
     bool enablePetLOS = sConfigMgr->GetOption<bool>("vmap.petLOS", true);
+    bool enableMemoryMappedModels = sConfigMgr->GetOption<bool>("vmap.memoryMapped", false);
     _bool_configs[CONFIG_VMAP_BLIZZLIKE_PVP_LOS] = sConfigMgr->GetOption<bool>("vmap.BlizzlikePvPLOS", true);
     _bool_configs[CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD] = sConfigMgr->GetOption<bool>("vmap.BlizzlikeLOSInOpenWorld", true);
 
@@ -1328,6 +1338,7 @@ void World::LoadConfigSettings(bool reload)
 
     VMAP::VMapFactory::createOrGetVMapMgr()->setEnableLineOfSightCalc(enableLOS);
     VMAP::VMapFactory::createOrGetVMapMgr()->setEnableHeightCalc(enableHeight);
+    VMAP::VMapFactory::createOrGetVMapMgr()->setEnableMemoryMappedModels(enableMemoryMappedModels);
     LOG_INFO("server.loading", "WORLD: VMap support included. LineOfSight:{}, getHeight:{}, indoorCheck:{} PetLOS:{}", enableLOS, enableHeight, enableIndoor, enablePetLOS);
 
     _bool_configs[CONFIG_PET_LOS]            = sConfigMgr->GetOption<bool>("vmap.petLOS", true);
@@ -1349,6 +1360,9 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_SHOW_MUTE_IN_WORLD]         = sConfigMgr->GetOption<bool>("ShowMuteInWorld", false);
     _bool_configs[CONFIG_SHOW_BAN_IN_WORLD]          = sConfigMgr->GetOption<bool>("ShowBanInWorld", false);
     _int_configs[CONFIG_NUMTHREADS]                  = sConfigMgr->GetOption<int32>("MapUpdate.Threads", 1);
+    _bool_configs[CONFIG_MAP_UPDATE_REGIONS]         = sConfigMgr->GetOption<bool>("MapUpdate.Regions.Enable", false);
+    _int_configs[CONFIG_MAP_UPDATE_REGIONS_THREADS]  = sConfigMgr->GetOption<int32>("MapUpdate.Regions.Threads", 2);
+    _int_configs[CONFIG_MAP_UPDATE_REGIONS_GRIDS]    = sConfigMgr->GetOption<int32>("MapUpdate.Regions.GridsPerRegion", 4);
     _int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetOption<int32>("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1422,6 +1436,13 @@ void World::LoadConfigSettings(bool reload)
     // Preload all grids of all non-instanced maps
     _bool_configs[CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS] = sConfigMgr->GetOption<bool>("PreloadAllNonInstancedMapGrids", false);
 
+    // Map the .map grid files instead of reading them
+    _bool_configs[CONFIG_MEMORY_MAPPED_MAPS] = sConfigMgr->GetOption<bool>("MemoryMappedMaps", false);
+
+    // Map the .dbc files and use their records in place where possible
+    _bool_configs[CONFIG_MEMORY_MAPPED_DBC] = sConfigMgr->GetOption<bool>("MemoryMappedDBC", false);
+    _int_configs[CONFIG_STARTUP_LOADER_THREADS] = sConfigMgr->GetOption<int32>("Startup.LoaderThreads", 1);
+
     // ICC buff override
     _int_configs[CONFIG_ICC_BUFF_HORDE] = sConfigMgr->GetOption<int32>("ICC.Buff.Horde", 73822);
     _int_configs[CONFIG_ICC_BUFF_ALLIANCE] = sConfigMgr->GetOption<int32>("ICC.Buff.Alliance", 73828);
@@ -1459,6 +1480,8 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_DEBUG_ARENA]        = sConfigMgr->GetOption<bool>("Debug.Arena",        false);
 
     _int_configs[CONFIG_GM_LEVEL_CHANNEL_MODERATION] = sConfigMgr->GetOption<int32>("Channel.ModerationGMLevel", 1);
+    _int_configs[CONFIG_CHANNEL_BROADCAST_THRESHOLD] = sConfigMgr->GetOption<uint32>("Channel.BroadcastThreshold", 500);
+    _int_configs[CONFIG_CHANNEL_BROADCAST_QUEUE_SIZE] = sConfigMgr->GetOption<uint32>("Channel.BroadcastQueueSize", 10000);
 
     _bool_configs[CONFIG_SET_BOP_ITEM_TRADEABLE] = sConfigMgr->GetOption<bool>("Item.SetItemTradeable", true);
 
@@ -1583,460 +1606,259 @@ void World::SetInitialWorldSettings()
     MMAP::MMapMgr* mmmgr = MMAP::MMapFactory::createOrGetMMapMgr();
     mmmgr->InitializeThreadUnsafe(mapIds);
 
-    LOG_INFO("server.loading", "Loading Game Graveyard...");
-    sGraveyard->LoadGraveyardFromDB();
-
-    LOG_INFO("server.loading", "Initializing PlayerDump Tables...");
-    PlayerDump::InitializeTables();
+    sWorldDatabaseSnapshotMgr->Initialize();
 
     ///- Initilize static helper structures
     AIRegistry::Initialize();
 
-    LOG_INFO("server.loading", "Loading SpellInfo Store...");
-    sSpellMgr->LoadSpellInfoStore();
-
-    LOG_INFO("server.loading", "Loading Spell Cooldown Overrides...");
-    sSpellMgr->LoadSpellCooldownOverrides();
-
-    LOG_INFO("server.loading", "Loading SpellInfo Data Corrections...");
-    sSpellMgr->LoadSpellInfoCorrections();
-
-    LOG_INFO("server.loading", "Loading Spell Rank Data...");
-    sSpellMgr->LoadSpellRanks();
-
-    LOG_INFO("server.loading", "Loading Spell Specific And Aura State...");
-    sSpellMgr->LoadSpellSpecificAndAuraState();
-
-    LOG_INFO("server.loading", "Loading SkillLineAbilityMultiMap Data...");
-    sSpellMgr->LoadSkillLineAbilityMap();
-
-    LOG_INFO("server.loading", "Loading SpellInfo Custom Attributes...");
-    sSpellMgr->LoadSpellInfoCustomAttributes();
-
-    LOG_INFO("server.loading", "Loading GameObject Models...");
-    LoadGameObjectModelList(_dataPath);
-
-    LOG_INFO("server.loading", "Loading Script Names...");
-    sObjectMgr->LoadScriptNames();
+    ///- Every loader below is a task of the startup graph. Loaders added with load() depend on the
+    ///- one before them, keeping the historical order; the branches added with startup.Add() only
+    ///- wait for what they read and may run next to the main sequence (Startup.LoaderThreads)
+    StartupTaskGraph startup;
+    StartupTaskGraph::TaskId previous = 0;
+    auto load = [&startup, &previous](std::string name, std::function<void()> function, std::vector<StartupTaskGraph::TaskId> dependencies = {})
+    {
+        if (startup.GetTaskCount())
+            dependencies.push_back(previous);
 
-    LOG_INFO("server.loading", "Loading Instance Template...");
-    sObjectMgr->LoadInstanceTemplate();
+        previous = startup.Add(std::move(name), std::move(function), std::move(dependencies));
+        return previous;
+    };
 
-    LOG_INFO("server.loading", "Loading Character Cache...");
-    sCharacterCache->LoadCharacterCacheStorage();
+    load("Loading Game Graveyard", []() { sGraveyard->LoadGraveyardFromDB(); });
+    load("Initializing PlayerDump Tables", []() { PlayerDump::InitializeTables(); });
+    load("Loading SpellInfo Store", []() { sSpellMgr->LoadSpellInfoStore(); });
+    load("Loading Spell Cooldown Overrides", []() { sSpellMgr->LoadSpellCooldownOverrides(); });
+    load("Loading SpellInfo Data Corrections", []() { sSpellMgr->LoadSpellInfoCorrections(); });
+    load("Loading Spell Rank Data", []() { sSpellMgr->LoadSpellRanks(); });
+    load("Loading Spell Specific And Aura State", []() { sSpellMgr->LoadSpellSpecificAndAuraState(); });
+    load("Loading SkillLineAbilityMultiMap Data", []() { sSpellMgr->LoadSkillLineAbilityMap(); });
+    StartupTaskGraph::TaskId spellInfo = load("Loading SpellInfo Custom Attributes", []() { sSpellMgr->LoadSpellInfoCustomAttributes(); });
+    load("Loading GameObject Models", [this]() { LoadGameObjectModelList(_dataPath); });
+    load("Loading Script Names", []() { sObjectMgr->LoadScriptNames(); });
+    load("Loading Instance Template", []() { sObjectMgr->LoadInstanceTemplate(); });
+
+    // Character cache only reads the characters database
+    StartupTaskGraph::TaskId characterCache = startup.Add("Loading Character Cache", []() { sCharacterCache->LoadCharacterCacheStorage(); });
 
     // Must be called before `creature_respawn`/`gameobject_respawn` tables
-    LOG_INFO("server.loading", "Loading Instances...");
-    sInstanceSaveMgr->LoadInstances();
-
-    LOG_INFO("server.loading", "Loading Broadcast Texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
-
-    LOG_INFO("server.loading", "Loading Localization Strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadItemSetNameLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadQuestOfferRewardLocale();
-    sObjectMgr->LoadQuestRequestItemsLocale();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-    sObjectMgr->LoadPetNamesLocales();
-
-    sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    LOG_INFO("server.loading", ">> Localization Strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
-
-    LOG_INFO("server.loading", "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
-
-    LOG_INFO("server.loading", "Loading Game Object Templates...");         // must be after LoadPageTexts
-    sObjectMgr->LoadGameObjectTemplate();
-
-    LOG_INFO("server.loading", "Loading Game Object Template Addons...");
-    sObjectMgr->LoadGameObjectTemplateAddons();
-
-    LOG_INFO("server.loading", "Loading Transport Templates...");
-    sTransportMgr->LoadTransportTemplates();
-
-    LOG_INFO("server.loading", "Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
-
-    LOG_INFO("server.loading", "Loading Spell Group Types...");
-    sSpellMgr->LoadSpellGroups();
-
-    LOG_INFO("server.loading", "Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
-
-    LOG_INFO("server.loading", "Loading Spell Proc Event Conditions...");
-    sSpellMgr->LoadSpellProcEvents();
-
-    LOG_INFO("server.loading", "Loading Spell Proc Conditions and Data...");
-    sSpellMgr->LoadSpellProcs();
-
-    LOG_INFO("server.loading", "Loading Spell Bonus Data...");
-    sSpellMgr->LoadSpellBonuses();
-
-    LOG_INFO("server.loading", "Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
-
-    LOG_INFO("server.loading", "Loading Mixology Bonuses...");
-    sSpellMgr->LoadSpellMixology();
-
-    LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
-
-    LOG_INFO("server.loading", "Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
-
-    LOG_INFO("server.loading", "Loading Enchant Spells Proc Datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
-
-    LOG_INFO("server.loading", "Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
-
-    LOG_INFO("server.loading", "Loading Disables");
-    DisableMgr::LoadDisables();                                  // must be before loading quests and items
-
-    LOG_INFO("server.loading", "Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr->LoadItemTemplates();
-
-    LOG_INFO("server.loading", "Loading Item Set Names...");                // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemSetNames();
-
-    LOG_INFO("server.loading", "Loading Creature Model Based Info Data...");
-    sObjectMgr->LoadCreatureModelInfo();
-
-    LOG_INFO("server.loading", "Loading Creature Custom IDs Config...");
-    sObjectMgr->LoadCreatureCustomIDs();
-
-    LOG_INFO("server.loading", "Loading Creature Templates...");
-    sObjectMgr->LoadCreatureTemplates();
-
-    LOG_INFO("server.loading", "Loading Equipment Templates...");           // must be after LoadCreatureTemplates
-    sObjectMgr->LoadEquipmentTemplates();
-
-    LOG_INFO("server.loading", "Loading Creature Template Addons...");
-    sObjectMgr->LoadCreatureTemplateAddons();
-
-    LOG_INFO("server.loading", "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
-
-    LOG_INFO("server.loading", "Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
-
-    LOG_INFO("server.loading", "Loading Reputation Spillover Data..." );
-    sObjectMgr->LoadReputationSpilloverTemplate();
-
-    LOG_INFO("server.loading", "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
-
-    LOG_INFO("server.loading", "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
-
-    LOG_INFO("server.loading", "Loading Creature Data...");
-    sObjectMgr->LoadCreatures();
-
-    LOG_INFO("server.loading", "Loading Temporary Summon Data...");
-    sObjectMgr->LoadTempSummons();                               // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
-
-    LOG_INFO("server.loading", "Loading Pet Levelup Spells...");
-    sSpellMgr->LoadPetLevelupSpellMap();
-
-    LOG_INFO("server.loading", "Loading Pet default Spells additional to Levelup Spells...");
-    sSpellMgr->LoadPetDefaultSpells();
-
-    LOG_INFO("server.loading", "Loading Creature Addon Data...");
-    sObjectMgr->LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
-
-    LOG_INFO("server.loading", "Loading Creature Movement Overrides...");
-    sObjectMgr->LoadCreatureMovementOverrides(); // must be after LoadCreatures()
-
-    LOG_INFO("server.loading", "Loading Gameobject Data...");
-    sObjectMgr->LoadGameobjects();
-
-    LOG_INFO("server.loading", "Loading GameObject Addon Data...");
-    sObjectMgr->LoadGameObjectAddons();                          // must be after LoadGameObjectTemplate() and LoadGameobjects()
-
-    LOG_INFO("server.loading", "Loading GameObject Quest Items...");
-    sObjectMgr->LoadGameObjectQuestItems();
-
-    LOG_INFO("server.loading", "Loading Creature Quest Items...");
-    sObjectMgr->LoadCreatureQuestItems();
-
-    LOG_INFO("server.loading", "Loading Creature Linked Respawn...");
-    sObjectMgr->LoadLinkedRespawn();                             // must be after LoadCreatures(), LoadGameObjects()
-
-    LOG_INFO("server.loading", "Loading Weather Data...");
-    WeatherMgr::LoadWeatherData();
-
-    LOG_INFO("server.loading", "Loading Quests...");
-    sObjectMgr->LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
-
-    LOG_INFO("server.loading", "Checking Quest Disables");
-    DisableMgr::CheckQuestDisables();                           // must be after loading quests
-
-    LOG_INFO("server.loading", "Loading Quest POI");
-    sObjectMgr->LoadQuestPOI();
-
-    LOG_INFO("server.loading", "Loading Quests Starters and Enders...");
-    sObjectMgr->LoadQuestStartersAndEnders();                    // must be after quest load
-
-    LOG_INFO("server.loading", "Loading Quest Greetings...");
-    sObjectMgr->LoadQuestGreetings();                               // must be loaded after creature_template, gameobject_template tables
-    LOG_INFO("server.loading", "Loading Quest Greeting Locales...");
-    sObjectMgr->LoadQuestGreetingsLocales();                        // must be loaded after creature_template, gameobject_template tables
-
-    LOG_INFO("server.loading", "Loading Quest Money Rewards...");
-    sObjectMgr->LoadQuestMoneyRewards();
-
-    LOG_INFO("server.loading", "Loading Objects Pooling Data...");
-    sPoolMgr->LoadFromDB();
-
-    LOG_INFO("server.loading", "Loading Game Event Data...");               // must be after loading pools fully
-    sGameEventMgr->LoadHolidayDates();                           // Must be after loading DBC
-    sGameEventMgr->LoadFromDB();                                 // Must be after loading holiday dates
-
-    LOG_INFO("server.loading", "Loading UNIT_NPC_FLAG_SPELLCLICK Data..."); // must be after LoadQuests
-    sObjectMgr->LoadNPCSpellClickSpells();
-
-    LOG_INFO("server.loading", "Loading Vehicle Template Accessories...");
-    sObjectMgr->LoadVehicleTemplateAccessories();                // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
-
-    LOG_INFO("server.loading", "Loading Vehicle Accessories...");
-    sObjectMgr->LoadVehicleAccessories();                       // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
-
-    LOG_INFO("server.loading", "Loading SpellArea Data...");                // must be after quest load
-    sSpellMgr->LoadSpellAreas();
-
-    LOG_INFO("server.loading", "Loading Area Trigger Definitions");
-    sObjectMgr->LoadAreaTriggers();
-
-    LOG_INFO("server.loading", "Loading Area Trigger Teleport Definitions...");
-    sObjectMgr->LoadAreaTriggerTeleports();
-
-    LOG_INFO("server.loading", "Loading Access Requirements...");
-    sObjectMgr->LoadAccessRequirements();                        // must be after item template load
-
-    LOG_INFO("server.loading", "Loading Quest Area Triggers...");
-    sObjectMgr->LoadQuestAreaTriggers();                         // must be after LoadQuests
-
-    LOG_INFO("server.loading", "Loading Tavern Area Triggers...");
-    sObjectMgr->LoadTavernAreaTriggers();
-
-    LOG_INFO("server.loading", "Loading AreaTrigger Script Names...");
-    sObjectMgr->LoadAreaTriggerScripts();
-
-    LOG_INFO("server.loading", "Loading LFG Entrance Positions..."); // Must be after areatriggers
-    sLFGMgr->LoadLFGDungeons();
-
-    LOG_INFO("server.loading", "Loading Dungeon Boss Data...");
-    sObjectMgr->LoadInstanceEncounters();
-
-    LOG_INFO("server.loading", "Loading LFG Rewards...");
-    sLFGMgr->LoadRewards();
-
-    LOG_INFO("server.loading", "Loading Graveyard-Zone Links...");
-    sGraveyard->LoadGraveyardZones();
-
-    LOG_INFO("server.loading", "Loading Spell Pet Auras...");
-    sSpellMgr->LoadSpellPetAuras();
-
-    LOG_INFO("server.loading", "Loading Spell Target Coordinates...");
-    sSpellMgr->LoadSpellTargetPositions();
-
-    LOG_INFO("server.loading", "Loading Enchant Custom Attributes...");
-    sSpellMgr->LoadEnchantCustomAttr();
-
-    LOG_INFO("server.loading", "Loading linked Spells...");
-    sSpellMgr->LoadSpellLinked();
-
-    LOG_INFO("server.loading", "Loading Player Create Data...");
-    sObjectMgr->LoadPlayerInfo();
-
-    LOG_INFO("server.loading", "Loading Exploration BaseXP Data...");
-    sObjectMgr->LoadExplorationBaseXP();
-
-    LOG_INFO("server.loading", "Loading Pet Name Parts...");
-    sObjectMgr->LoadPetNames();
-
-    CharacterDatabaseCleaner::CleanDatabase();
-
-    LOG_INFO("server.loading", "Loading The Max Pet Number...");
-    sObjectMgr->LoadPetNumber();
-
-    LOG_INFO("server.loading", "Loading Pet Level Stats...");
-    sObjectMgr->LoadPetLevelInfo();
-
-    LOG_INFO("server.loading", "Loading Player Level Dependent Mail Rewards...");
-    sObjectMgr->LoadMailLevelRewards();
-
-    LOG_INFO("server.loading", "Load Mail Server Template...");
-    sObjectMgr->LoadMailServerTemplates();
-
-    // Loot tables
-    LoadLootTables();
-
-    LOG_INFO("server.loading", "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
-
-    LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
-
-    LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
-    LoadSkillPerfectItemTable();
-
-    LOG_INFO("server.loading", "Loading Skill Fishing Base Level Requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
-
-    LOG_INFO("server.loading", "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-    LOG_INFO("server.loading", "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-    LOG_INFO("server.loading", "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-    LOG_INFO("server.loading", "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-    LOG_INFO("server.loading", "Loading Achievement Reward Locales...");
-    sAchievementMgr->LoadRewardLocales();
-    LOG_INFO("server.loading", "Loading Completed Achievements...");
-    sAchievementMgr->LoadCompletedAchievements();
-
-    ///- Load dynamic data tables from the database
-    LOG_INFO("server.loading", "Loading Item Auctions...");
-    sAuctionMgr->LoadAuctionItems();
-    LOG_INFO("server.loading", "Loading Auctions...");
-    sAuctionMgr->LoadAuctions();
-
-    sGuildMgr->LoadGuilds();
-
-    LOG_INFO("server.loading", "Loading ArenaTeams...");
-    sArenaTeamMgr->LoadArenaTeams();
-
-    LOG_INFO("server.loading", "Loading Groups...");
-    sGroupMgr->LoadGroups();
-
-    LOG_INFO("server.loading", "Loading Reserved Names...");
-    sObjectMgr->LoadReservedPlayerNamesDB();
-    sObjectMgr->LoadReservedPlayerNamesDBC(); // Needs to be after LoadReservedPlayerNamesDB()
-
-    LOG_INFO("server.loading", "Loading Profanity Names...");
-    sObjectMgr->LoadProfanityNamesFromDB();
-    sObjectMgr->LoadProfanityNamesFromDBC(); // Needs to be after LoadProfanityNamesFromDB()
-
-    LOG_INFO("server.loading", "Loading GameObjects for Quests...");
-    sObjectMgr->LoadGameObjectForQuests();
-
-    LOG_INFO("server.loading", "Loading BattleMasters...");
-    sBattlegroundMgr->LoadBattleMastersEntry();
-
-    LOG_INFO("server.loading", "Loading GameTeleports...");
-    sObjectMgr->LoadGameTele();
-
-    LOG_INFO("server.loading", "Loading Gossip Menu...");
-    sObjectMgr->LoadGossipMenu();
-
-    LOG_INFO("server.loading", "Loading Gossip Menu Options...");
-    sObjectMgr->LoadGossipMenuItems();
-
-    LOG_INFO("server.loading", "Loading Vendors...");
-    sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
-
-    LOG_INFO("server.loading", "Loading Trainers...");
-    sObjectMgr->LoadTrainerSpell();                              // must be after load CreatureTemplate
-
-    LOG_INFO("server.loading", "Loading Waypoints...");
-    sWaypointMgr->Load();
-
-    LOG_INFO("server.loading", "Loading SmartAI Waypoints...");
-    sSmartWaypointMgr->LoadFromDB();
-
-    LOG_INFO("server.loading", "Loading Creature Formations...");
-    sFormationMgr->LoadCreatureFormations();
-
-    LOG_INFO("server.loading", "Loading World States...");              // must be loaded before battleground, outdoor PvP and conditions
-    LoadWorldStates();
-
-    LOG_INFO("server.loading", "Loading Conditions...");
-    sConditionMgr->LoadConditions();
-
-    LOG_INFO("server.loading", "Loading Faction Change Achievement Pairs...");
-    sObjectMgr->LoadFactionChangeAchievements();
-
-    LOG_INFO("server.loading", "Loading Faction Change Spell Pairs...");
-    sObjectMgr->LoadFactionChangeSpells();
-
-    LOG_INFO("server.loading", "Loading Faction Change Item Pairs...");
-    sObjectMgr->LoadFactionChangeItems();
-
-    LOG_INFO("server.loading", "Loading Faction Change Reputation Pairs...");
-    sObjectMgr->LoadFactionChangeReputations();
-
-    LOG_INFO("server.loading", "Loading Faction Change Title Pairs...");
-    sObjectMgr->LoadFactionChangeTitles();
-
-    LOG_INFO("server.loading", "Loading Faction Change Quest Pairs...");
-    sObjectMgr->LoadFactionChangeQuests();
-
-    LOG_INFO("server.loading", "Loading GM Tickets...");
-    sTicketMgr->LoadTickets();
-
-    LOG_INFO("server.loading", "Loading GM Surveys...");
-    sTicketMgr->LoadSurveys();
-
-    LOG_INFO("server.loading", "Loading Client Addons...");
-    AddonMgr::LoadFromDB();
+    StartupTaskGraph::TaskId instances = load("Loading Instances", []() { sInstanceSaveMgr->LoadInstances(); }, { characterCache });
+
+    // Text stores only check DBC data
+    StartupTaskGraph::TaskId broadcastTexts = startup.Add("Loading Broadcast Texts", []()
+    {
+        sObjectMgr->LoadBroadcastTexts();
+        sObjectMgr->LoadBroadcastTextLocales();
+    });
+
+    startup.Add("Loading Localization Strings", [this]()
+    {
+        uint32 oldMSTime = getMSTime();
+        sObjectMgr->LoadCreatureLocales();
+        sObjectMgr->LoadGameObjectLocales();
+        sObjectMgr->LoadItemLocales();
+        sObjectMgr->LoadItemSetNameLocales();
+        sObjectMgr->LoadQuestLocales();
+        sObjectMgr->LoadQuestOfferRewardLocale();
+        sObjectMgr->LoadQuestRequestItemsLocale();
+        sObjectMgr->LoadNpcTextLocales();
+        sObjectMgr->LoadPageTextLocales();
+        sObjectMgr->LoadGossipMenuItemsLocales();
+        sObjectMgr->LoadPointOfInterestLocales();
+        sObjectMgr->LoadPetNamesLocales();
+
+        sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
+        LOG_INFO("server.loading", ">> Localization Strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
+        LOG_INFO("server.loading", " ");
+    });
+
+    load("Loading Page Texts", []() { sObjectMgr->LoadPageTexts(); });
+    load("Loading Game Object Templates", []() { sObjectMgr->LoadGameObjectTemplate(); });         // must be after LoadPageTexts
+    load("Loading Game Object Template Addons", []() { sObjectMgr->LoadGameObjectTemplateAddons(); });
+    load("Loading Transport Templates", []() { sTransportMgr->LoadTransportTemplates(); });
+
+    // Spell data fills SpellMgr containers and only reads SpellInfo, which stays unmodified until Disables
+    StartupTaskGraph::TaskId spellData = startup.Add("Loading Spell Required Data", []() { sSpellMgr->LoadSpellRequired(); }, { spellInfo });
+    spellData = startup.Add("Loading Spell Group Types", []() { sSpellMgr->LoadSpellGroups(); }, { spellData });
+    spellData = startup.Add("Loading Spell Learn Skills", []() { sSpellMgr->LoadSpellLearnSkills(); }, { spellData }); // must be after LoadSpellRanks
+    spellData = startup.Add("Loading Spell Proc Event Conditions", []() { sSpellMgr->LoadSpellProcEvents(); }, { spellData });
+    spellData = startup.Add("Loading Spell Proc Conditions and Data", []() { sSpellMgr->LoadSpellProcs(); }, { spellData });
+    spellData = startup.Add("Loading Spell Bonus Data", []() { sSpellMgr->LoadSpellBonuses(); }, { spellData });
+    spellData = startup.Add("Loading Aggro Spells Definitions", []() { sSpellMgr->LoadSpellThreats(); }, { spellData });
+    spellData = startup.Add("Loading Mixology Bonuses", []() { sSpellMgr->LoadSpellMixology(); }, { spellData });
+    spellData = startup.Add("Loading Spell Group Stack Rules", []() { sSpellMgr->LoadSpellGroupStackRules(); }, { spellData });
+
+    StartupTaskGraph::TaskId gossipTexts = startup.Add("Loading NPC Texts", []() { sObjectMgr->LoadGossipText(); }, { broadcastTexts });
+
+    spellData = startup.Add("Loading Enchant Spells Proc Datas", []() { sSpellMgr->LoadSpellEnchantProcData(); }, { spellData });
+
+    load("Loading Item Random Enchantments Table", []() { LoadRandomEnchantmentsTable(); });
+    load("Loading Disables", []() { DisableMgr::LoadDisables(); }, { spellData });                  // must be before loading quests and items
+    load("Loading Items", []() { sObjectMgr->LoadItemTemplates(); });                               // must be after LoadRandomEnchantmentsTable and LoadPageTexts
+    StartupTaskGraph::TaskId items = load("Loading Item Set Names", []() { sObjectMgr->LoadItemSetNames(); }); // must be after LoadItemPrototypes
+    load("Loading Creature Model Based Info Data", []() { sObjectMgr->LoadCreatureModelInfo(); });
+    load("Loading Creature Custom IDs Config", []() { sObjectMgr->LoadCreatureCustomIDs(); });
+    load("Loading Creature Templates", []() { sObjectMgr->LoadCreatureTemplates(); });
+    load("Loading Equipment Templates", []() { sObjectMgr->LoadEquipmentTemplates(); });           // must be after LoadCreatureTemplates
+    load("Loading Creature Template Addons", []() { sObjectMgr->LoadCreatureTemplateAddons(); });
+    load("Loading Reputation Reward Rates", []() { sObjectMgr->LoadReputationRewardRate(); });
+    load("Loading Creature Reputation OnKill Data", []() { sObjectMgr->LoadReputationOnKill(); });
+    load("Loading Reputation Spillover Data", []() { sObjectMgr->LoadReputationSpilloverTemplate(); });
+    load("Loading Points Of Interest Data", []() { sObjectMgr->LoadPointsOfInterest(); });
+    load("Loading Creature Base Stats", []() { sObjectMgr->LoadCreatureClassLevelStats(); });
+    load("Loading Creature Data", []() { sObjectMgr->LoadCreatures(); });
+    load("Loading Temporary Summon Data", []() { sObjectMgr->LoadTempSummons(); });                 // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
+    load("Loading Pet Levelup Spells", []() { sSpellMgr->LoadPetLevelupSpellMap(); });
+    load("Loading Pet default Spells additional to Levelup Spells", []() { sSpellMgr->LoadPetDefaultSpells(); });
+    load("Loading Creature Addon Data", []() { sObjectMgr->LoadCreatureAddons(); });                // must be after LoadCreatureTemplates() and LoadCreatures()
+    load("Loading Creature Movement Overrides", []() { sObjectMgr->LoadCreatureMovementOverrides(); }); // must be after LoadCreatures()
+    load("Loading Gameobject Data", []() { sObjectMgr->LoadGameobjects(); });
+    load("Loading GameObject Addon Data", []() { sObjectMgr->LoadGameObjectAddons(); });            // must be after LoadGameObjectTemplate() and LoadGameobjects()
+    load("Loading GameObject Quest Items", []() { sObjectMgr->LoadGameObjectQuestItems(); });
+    load("Loading Creature Quest Items", []() { sObjectMgr->LoadCreatureQuestItems(); });
+    load("Loading Creature Linked Respawn", []() { sObjectMgr->LoadLinkedRespawn(); });             // must be after LoadCreatures(), LoadGameObjects()
+    load("Loading Weather Data", []() { WeatherMgr::LoadWeatherData(); });
+    load("Loading Quests", []() { sObjectMgr->LoadQuests(); });                                     // must be loaded after DBCs, creature_template, item_template, gameobject tables
+    load("Checking Quest Disables", []() { DisableMgr::CheckQuestDisables(); });                   // must be after loading quests
+    load("Loading Quest POI", []() { sObjectMgr->LoadQuestPOI(); });
+    load("Loading Quests Starters and Enders", []() { sObjectMgr->LoadQuestStartersAndEnders(); }); // must be after quest load
+    load("Loading Quest Greetings", []() { sObjectMgr->LoadQuestGreetings(); });                   // must be loaded after creature_template, gameobject_template tables
+    load("Loading Quest Greeting Locales", []() { sObjectMgr->LoadQuestGreetingsLocales(); });     // must be loaded after creature_template, gameobject_template tables
+    load("Loading Quest Money Rewards", []() { sObjectMgr->LoadQuestMoneyRewards(); });
+    load("Loading Objects Pooling Data", []() { sPoolMgr->LoadFromDB(); });
+    load("Loading Game Event Data", []()                                                           // must be after loading pools fully
+    {
+        sGameEventMgr->LoadHolidayDates();                       // Must be after loading DBC
+        sGameEventMgr->LoadFromDB();                             // Must be after loading holiday dates
+    });
+    load("Loading UNIT_NPC_FLAG_SPELLCLICK Data", []() { sObjectMgr->LoadNPCSpellClickSpells(); }); // must be after LoadQuests
+    load("Loading Vehicle Template Accessories", []() { sObjectMgr->LoadVehicleTemplateAccessories(); }); // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
+    load("Loading Vehicle Accessories", []() { sObjectMgr->LoadVehicleAccessories(); });           // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
+    load("Loading SpellArea Data", []() { sSpellMgr->LoadSpellAreas(); });                         // must be after quest load
+    load("Loading Area Trigger Definitions", []() { sObjectMgr->LoadAreaTriggers(); });
+    load("Loading Area Trigger Teleport Definitions", []() { sObjectMgr->LoadAreaTriggerTeleports(); });
+    load("Loading Access Requirements", []() { sObjectMgr->LoadAccessRequirements(); });           // must be after item template load
+    load("Loading Quest Area Triggers", []() { sObjectMgr->LoadQuestAreaTriggers(); });            // must be after LoadQuests
+    load("Loading Tavern Area Triggers", []() { sObjectMgr->LoadTavernAreaTriggers(); });
+    load("Loading AreaTrigger Script Names", []() { sObjectMgr->LoadAreaTriggerScripts(); });
+    load("Loading LFG Entrance Positions", []() { sLFGMgr->LoadLFGDungeons(); });                  // Must be after areatriggers
+    load("Loading Dungeon Boss Data", []() { sObjectMgr->LoadInstanceEncounters(); });
+    load("Loading LFG Rewards", []() { sLFGMgr->LoadRewards(); });
+    load("Loading Graveyard-Zone Links", []() { sGraveyard->LoadGraveyardZones(); });
+    load("Loading Spell Pet Auras", []() { sSpellMgr->LoadSpellPetAuras(); });
+    load("Loading Spell Target Coordinates", []() { sSpellMgr->LoadSpellTargetPositions(); });
+    load("Loading Enchant Custom Attributes", []() { sSpellMgr->LoadEnchantCustomAttr(); });
+    load("Loading linked Spells", []() { sSpellMgr->LoadSpellLinked(); });
+    load("Loading Player Create Data", []() { sObjectMgr->LoadPlayerInfo(); });
+    load("Loading Exploration BaseXP Data", []() { sObjectMgr->LoadExplorationBaseXP(); });
+    load("Loading Pet Name Parts", []() { sObjectMgr->LoadPetNames(); });
+    load("Cleaning Character Database", []() { CharacterDatabaseCleaner::CleanDatabase(); });
+    load("Loading The Max Pet Number", []() { sObjectMgr->LoadPetNumber(); });
+    load("Loading Pet Level Stats", []() { sObjectMgr->LoadPetLevelInfo(); });
+    load("Loading Player Level Dependent Mail Rewards", []() { sObjectMgr->LoadMailLevelRewards(); });
+    load("Load Mail Server Template", []() { sObjectMgr->LoadMailServerTemplates(); });
+    load("Loading Loot Tables", []() { LoadLootTables(); });
+    load("Loading Skill Discovery Table", []() { LoadSkillDiscoveryTable(); });
+    load("Loading Skill Extra Item Table", []() { LoadSkillExtraItemTable(); });
+    load("Loading Skill Perfection Data Table", []() { LoadSkillPerfectItemTable(); });
+    load("Loading Skill Fishing Base Level Requirements", []() { sObjectMgr->LoadFishingBaseSkillLevel(); });
+    load("Loading Achievements", []() { sAchievementMgr->LoadAchievementReferenceList(); });
+    load("Loading Achievement Criteria Lists", []() { sAchievementMgr->LoadAchievementCriteriaList(); });
+    load("Loading Achievement Criteria Data", []() { sAchievementMgr->LoadAchievementCriteriaData(); });
+    load("Loading Achievement Rewards", []() { sAchievementMgr->LoadRewards(); });
+    load("Loading Achievement Reward Locales", []() { sAchievementMgr->LoadRewardLocales(); });
+    load("Loading Completed Achievements", []() { sAchievementMgr->LoadCompletedAchievements(); });
+
+    // Dynamic data tables of the characters database, needing item templates, the character cache and instances.
+    // Guilds, arena teams and groups write to the character cache: every later reader of the cache waits for them
+    StartupTaskGraph::TaskId dynamicData = startup.Add("Loading Item Auctions", []() { sAuctionMgr->LoadAuctionItems(); }, { items, characterCache, instances });
+    dynamicData = startup.Add("Loading Auctions", []() { sAuctionMgr->LoadAuctions(); }, { dynamicData });
+    dynamicData = startup.Add("Loading Guilds", []() { sGuildMgr->LoadGuilds(); }, { dynamicData });
+    dynamicData = startup.Add("Loading ArenaTeams", []() { sArenaTeamMgr->LoadArenaTeams(); }, { dynamicData });
+    dynamicData = startup.Add("Loading Groups", []() { sGroupMgr->LoadGroups(); }, { dynamicData });
+
+    load("Loading Reserved Names", []()
+    {
+        sObjectMgr->LoadReservedPlayerNamesDB();
+        sObjectMgr->LoadReservedPlayerNamesDBC(); // Needs to be after LoadReservedPlayerNamesDB()
+    });
+    load("Loading Profanity Names", []()
+    {
+        sObjectMgr->LoadProfanityNamesFromDB();
+        sObjectMgr->LoadProfanityNamesFromDBC(); // Needs to be after LoadProfanityNamesFromDB()
+    });
+    load("Loading GameObjects for Quests", []() { sObjectMgr->LoadGameObjectForQuests(); });
+
+    // Last loader writing to creature templates (npcflag), readers outside the main sequence wait for it
+    StartupTaskGraph::TaskId creatureTemplates = load("Loading BattleMasters", []() { sBattlegroundMgr->LoadBattleMastersEntry(); });
+
+    load("Loading GameTeleports", []() { sObjectMgr->LoadGameTele(); });
+    load("Loading Gossip Menu", []() { sObjectMgr->LoadGossipMenu(); }, { gossipTexts });
+    load("Loading Gossip Menu Options", []() { sObjectMgr->LoadGossipMenuItems(); }, { broadcastTexts });
+    load("Loading Vendors", []() { sObjectMgr->LoadVendors(); });                                   // must be after load CreatureTemplate and ItemTemplate
+    load("Loading Trainers", []() { sObjectMgr->LoadTrainerSpell(); });                            // must be after load CreatureTemplate
+
+    // Waypoint stores are only read by formations and SmartAI
+    StartupTaskGraph::TaskId waypoints = startup.Add("Loading Waypoints", []() { sWaypointMgr->Load(); });
+    waypoints = startup.Add("Loading SmartAI Waypoints", []() { sSmartWaypointMgr->LoadFromDB(); }, { waypoints });
+
+    load("Loading Creature Formations", []() { sFormationMgr->LoadCreatureFormations(); }, { waypoints });
+    load("Loading World States", [this]() { LoadWorldStates(); });                                 // must be loaded before battleground, outdoor PvP and conditions
+    load("Loading Conditions", []() { sConditionMgr->LoadConditions(); });
+    load("Loading Faction Change Achievement Pairs", []() { sObjectMgr->LoadFactionChangeAchievements(); });
+    load("Loading Faction Change Spell Pairs", []() { sObjectMgr->LoadFactionChangeSpells(); });
+    load("Loading Faction Change Item Pairs", []() { sObjectMgr->LoadFactionChangeItems(); });
+    load("Loading Faction Change Reputation Pairs", []() { sObjectMgr->LoadFactionChangeReputations(); });
+    load("Loading Faction Change Title Pairs", []() { sObjectMgr->LoadFactionChangeTitles(); });
+    load("Loading Faction Change Quest Pairs", []() { sObjectMgr->LoadFactionChangeQuests(); });
+    load("Loading GM Tickets", []() { sTicketMgr->LoadTickets(); }, { dynamicData });
+    load("Loading GM Surveys", []() { sTicketMgr->LoadSurveys(); });
+    load("Loading Client Addons", []() { AddonMgr::LoadFromDB(); });
 
     // pussywizard:
-    LOG_INFO("server.loading", "Deleting Invalid Mail Items...");
-    LOG_INFO("server.loading", " ");
-    CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN item_instance ii ON mi.item_guid = ii.guid WHERE ii.guid IS NULL");
-    CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN mail m ON mi.mail_id = m.id WHERE m.id IS NULL");
-    CharacterDatabase.Execute("UPDATE mail m LEFT JOIN mail_items mi ON m.id = mi.mail_id SET m.has_items=0 WHERE m.has_items<>0 AND mi.mail_id IS NULL");
+    load("Deleting Invalid Mail Items", []()
+    {
+        LOG_INFO("server.loading", " ");
+        CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN item_instance ii ON mi.item_guid = ii.guid WHERE ii.guid IS NULL");
+        CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN mail m ON mi.mail_id = m.id WHERE m.id IS NULL");
+        CharacterDatabase.Execute("UPDATE mail m LEFT JOIN mail_items mi ON m.id = mi.mail_id SET m.has_items=0 WHERE m.has_items<>0 AND mi.mail_id IS NULL");
+    });
 
     ///- Handle outdated emails (delete/return)
-    LOG_INFO("server.loading", "Returning Old Mails...");
-    LOG_INFO("server.loading", " ");
-    sObjectMgr->ReturnOrDeleteOldMails(false);
+    load("Returning Old Mails", []()
+    {
+        LOG_INFO("server.loading", " ");
+        sObjectMgr->ReturnOrDeleteOldMails(false);
+    }, { dynamicData });
 
     ///- Load AutoBroadCast
-    LOG_INFO("server.loading", "Loading Autobroadcasts...");
-    sAutobroadcastMgr->LoadAutobroadcasts();
+    load("Loading Autobroadcasts", []() { sAutobroadcastMgr->LoadAutobroadcasts(); });
 
     ///- Load Motd
-    LOG_INFO("server.loading", "Loading Motd...");
-    sMotdMgr->LoadMotd();
+    load("Loading Motd", []() { sMotdMgr->LoadMotd(); });
 
     ///- Load and initialize scripts
-    sObjectMgr->LoadSpellScripts();                              // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr->LoadEventScripts();                              // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr->LoadWaypointScripts();
-
-    LOG_INFO("server.loading", "Loading Spell Script Names...");
-    sObjectMgr->LoadSpellScriptNames();
-
-    LOG_INFO("server.loading", "Loading Creature Texts...");
-    sCreatureTextMgr->LoadCreatureTexts();
-
-    LOG_INFO("server.loading", "Loading Creature Text Locales...");
-    sCreatureTextMgr->LoadCreatureTextLocales();
+    load("Loading Spell, Event and Waypoint Scripts", []()
+    {
+        sObjectMgr->LoadSpellScripts();                          // must be after load Creature/Gameobject(Template/Data)
+        sObjectMgr->LoadEventScripts();                          // must be after load Creature/Gameobject(Template/Data)
+        sObjectMgr->LoadWaypointScripts();
+    });
 
-    LOG_INFO("server.loading", "Loading Scripts...");
-    sScriptMgr->LoadDatabase();
+    load("Loading Spell Script Names", []() { sObjectMgr->LoadSpellScriptNames(); });
 
-    LOG_INFO("server.loading", "Validating Spell Scripts...");
-    sObjectMgr->ValidateSpellScripts();
+    // Creature texts check creature templates and broadcast texts
+    StartupTaskGraph::TaskId creatureTexts = startup.Add("Loading Creature Texts", []() { sCreatureTextMgr->LoadCreatureTexts(); }, { creatureTemplates, broadcastTexts });
+    creatureTexts = startup.Add("Loading Creature Text Locales", []() { sCreatureTextMgr->LoadCreatureTextLocales(); }, { creatureTexts });
 
-    LOG_INFO("server.loading", "Loading SmartAI Scripts...");
-    sSmartScriptMgr->LoadSmartAIFromDB();
+    load("Loading Scripts", []() { sScriptMgr->LoadDatabase(); }, { creatureTexts });
+    load("Validating Spell Scripts", []() { sObjectMgr->ValidateSpellScripts(); });
+    load("Loading SmartAI Scripts", []() { sSmartScriptMgr->LoadSmartAIFromDB(); });
+    load("Loading Calendar Data", []() { sCalendarMgr->LoadFromDB(); }, { dynamicData });
 
-    LOG_INFO("server.loading", "Loading Calendar Data...");
-    sCalendarMgr->LoadFromDB();
+    startup.Run(std::max<int32>(1, getIntConfig(CONFIG_STARTUP_LOADER_THREADS)));
+    startup.LogReport(_startupProfile);
+    sWorldDatabaseSnapshotMgr->FinishStartup();
 
     LOG_INFO("server.loading", "Initializing SpellInfo Precomputed Data..."); // must be called after loading items, professions, spells and pretty much anything
     LOG_INFO("server.loading", " ");
@@ -2069,8 +1891,6 @@ void World::SetInitialWorldSettings()
     // our speed up
     _timers[WUPDATE_5_SECS].SetInterval(5 * IN_MILLISECONDS);
 
-    _timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // update who list cache every 5 seconds
-
     _mail_expire_check_timer = GameTime::GetGameTime() + 6h;
 
     ///- Initialize MapMgr
@@ -2164,6 +1984,7 @@ void World::SetInitialWorldSettings()
     if (sWorld->getBoolConfig(CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS))
     {
         LOG_INFO("server.loading", "Loading All Grids For All Non-Instanced Maps...");
+        uint32 oldMSTime = getMSTime();
 
         for (uint32 i = 0; i < sMapStore.GetNumRows(); ++i)
         {
@@ -2180,6 +2001,9 @@ void World::SetInitialWorldSettings()
                 }
             }
         }
+
+        LOG_INFO("server.loading", ">> Loaded All Grids in {} ms ({} map files)", GetMSTimeDiffToNow(oldMSTime),
+            getBoolConfig(CONFIG_MEMORY_MAPPED_MAPS) ? "memory mapped" : "read");
     }
 
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
@@ -2276,14 +2100,6 @@ void World::Update(uint32 diff)
         CharacterDatabase.Execute(stmt);
     }
 
-    ///- Update Who List Cache
-    if (_timers[WUPDATE_WHO_LIST].Passed())
-    {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update who list"));
-        _timers[WUPDATE_WHO_LIST].Reset();
-        sWhoListCacheMgr->Update();
-    }
-
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Check quest reset times"));
 
@@ -2335,8 +2151,6 @@ void World::Update(uint32 diff)
         sAuctionMgr->Update();
     }
 
-    AsyncAuctionListingMgr::Update(Milliseconds(diff));
-
     if (currentGameTime > _mail_expire_check_timer)
     {
         sObjectMgr->ReturnOrDeleteOldMails(true);
@@ -2505,6 +2319,7 @@ void World::ForceGameEventUpdate()
 /// Send a packet to all players (except self if mentioned)
 void World::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    SharedWorldPacketPtr sharedPacket = std::make_shared<SharedWorldPacket>(*packet);
     SessionMap::const_iterator itr;
     for (itr = _sessions.begin(); itr != _sessions.end(); ++itr)
     {
@@ -2514,7 +2329,7 @@ void World::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, Tea
                 itr->second != self &&
                 (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendSharedPacket(sharedPacket);
         }
     }
 }
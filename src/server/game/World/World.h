@@ -69,7 +69,6 @@ enum WorldTimers
     WUPDATE_MAILBOXQUEUE,
     WUPDATE_PINGDB,
     WUPDATE_5_SECS,
-    WUPDATE_WHO_LIST,
     WUPDATE_COUNT
 };
 
@@ -236,6 +235,7 @@ public:
     }
 
     void SetInitialWorldSettings() override;
+    void SetStartupProfile(bool profile) override { _startupProfile = profile; }
     void LoadConfigSettings(bool reload = false) override;
 
     void SendGlobalMessage(WorldPacket const* packet, WorldSession* self = nullptr, TeamId teamId = TEAM_NEUTRAL) override;
@@ -374,6 +374,7 @@ private:
     uint32 _cleaningFlags;
 
     bool _isClosed;
+    bool _startupProfile;
 
     IntervalTimer _timers[WUPDATE_COUNT];
     Seconds _mail_expire_check_timer;
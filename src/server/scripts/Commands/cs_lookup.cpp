@@ -786,8 +786,9 @@ public:
         uint32 count = 0;
         uint32 maxResults = sWorld->getIntConfig(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS);
 
-        for (auto const& [entry, qInfo] : sObjectMgr->GetQuestTemplates())
+        for (auto const& [entry, quest] : sObjectMgr->GetQuestTemplates())
         {
+            Quest const* qInfo = &quest;
             int localeIndex = handler->GetSessionDbLocaleIndex();
             if (localeIndex >= 0)
             {
@@ -17,6 +17,9 @@
 
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
+#include "MappedFile.h"
+
+bool DBCStorageBase::_useMemoryMapping = false;
 
 DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
 {
@@ -33,6 +36,9 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
 {
     indexTable = nullptr;
 
+    if (_useMemoryMapping)
+        return LoadMapped(path, indexTable);
+
     DBCFileLoader dbc;
 
     // Check if load was sucessful, only then continue
@@ -52,12 +58,55 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
     return indexTable != nullptr;
 }
 
+bool DBCStorageBase::LoadMapped(char const* path, char**& indexTable)
+{
+    std::unique_ptr<MappedFile> file = std::make_unique<MappedFile>();
+    DBCFileLoader dbc;
+
+    if (!file->Open(path, true) || !dbc.Load(*file, _fileFormat))
+        return false;
+
+    _fieldCount = dbc.GetCols();
+
+    bool keepMapping;
+    if (dbc.CanUseRecordsInPlace(_fileFormat))
+    {
+        dbc.MapData(_fileFormat, _indexTableSize, indexTable);
+        keepMapping = true;
+    }
+    else
+    {
+        _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
+        keepMapping = dbc.MapStrings(_fileFormat, _dataTable);
+    }
+
+    if (keepMapping)
+        _mappedFiles.push_back(std::move(file));
+
+    return indexTable != nullptr;
+}
+
 bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
 {
     // DBC must be already loaded using Load
     if (!indexTable)
         return false;
 
+    if (_useMemoryMapping)
+    {
+        std::unique_ptr<MappedFile> file = std::make_unique<MappedFile>();
+        DBCFileLoader dbc;
+
+        if (!file->Open(path, true) || !dbc.Load(*file, _fileFormat))
+            return false;
+
+        // strings of another locale, records without strings need nothing from the file
+        if (dbc.MapStrings(_fileFormat, _dataTable))
+            _mappedFiles.push_back(std::move(file));
+
+        return true;
+    }
+
     DBCFileLoader dbc;
 
     // Check if load was successful, only then continue
@@ -22,8 +22,11 @@
 #include "DBCStorageIterator.h"
 #include "Errors.h"
 #include <cstring>
+#include <memory>
 #include <vector>
 
+class MappedFile;
+
 /// Interface class for common access
 class DBCStorageBase
 {
@@ -38,8 +41,13 @@ public:
     virtual bool LoadStringsFrom(char const* path) = 0;
     virtual void LoadFromDB(char const* table, char const* format) = 0;
 
+    /// Map dbc files instead of reading them. Records whose layout matches the file are used in place
+    /// and strings point into the mapped string blocks, only converted records are allocated.
+    static void SetUseMemoryMapping(bool enable) { _useMemoryMapping = enable; }
+
 protected:
     bool Load(char const* path, char**& indexTable);
+    bool LoadMapped(char const* path, char**& indexTable);
     bool LoadStringsFrom(char const* path, char** indexTable);
     void LoadFromDB(char const* table, char const* format, char**& indexTable);
 
@@ -47,7 +55,10 @@ protected:
     char const* _fileFormat;
     char* _dataTable;
     std::vector<char*> _stringPool;
+    std::vector<std::unique_ptr<MappedFile>> _mappedFiles;
     uint32 _indexTableSize;
+
+    static bool _useMemoryMapping;
 };
 
 template <class T>
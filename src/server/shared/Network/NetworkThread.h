@@ -23,6 +23,7 @@
 #include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "Metric.h"
 #include "Socket.h"
 #include "Timer.h"
 #include <atomic>
@@ -40,7 +41,8 @@ class NetworkThread
 {
 public:
     NetworkThread() :
-        _ioContext(1), _acceptSocket(_ioContext), _updateTimer(_ioContext), _proxyHeaderReadingEnabled(false) { }
+        _ioContext(1), _acceptSocket(_ioContext), _updateTimer(_ioContext), _proxyHeaderReadingEnabled(false),
+        _threadId(++_threadCounter), _scheduledUpdates(0), _lastMetricTime(std::chrono::steady_clock::now()) { }
 
     virtual ~NetworkThread()
     {
@@ -181,7 +183,7 @@ protected:
     {
         LOG_DEBUG("misc", "Network Thread Starting");
 
-        _updateTimer.expires_from_now(boost::posix_time::milliseconds(1));
+        _updateTimer.expires_from_now(boost::posix_time::milliseconds(SWEEP_INTERVAL));
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
         _ioContext.run();
 
@@ -195,13 +197,18 @@ protected:
         if (_stopped)
             return;
 
-        _updateTimer.expires_from_now(boost::posix_time::milliseconds(1));
+        _updateTimer.expires_from_now(boost::posix_time::milliseconds(SWEEP_INTERVAL));
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
 
         AddNewSockets();
+        UpdateMetrics();
 
         _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [this](std::shared_ptr<SocketType> sock)
         {
+            // output is flushed through ScheduleUpdate, idle sockets are not updated here
+            if (!sock->HasPendingWork())
+                return false;
+
             if (!sock->Update())
             {
                 if (sock->IsOpen())
@@ -217,9 +224,32 @@ protected:
         }), _sockets.end());
     }
 
+    void UpdateMetrics()
+    {
+        _scheduledUpdates += SocketType::ConsumeScheduledUpdateCount();
+
+        auto now = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - _lastMetricTime).count();
+        if (elapsed < 1000)
+            return;
+
+        METRIC_VALUE("network_wakeups", uint64(_scheduledUpdates * 1000 / elapsed), METRIC_TAG("thread", std::to_string(_threadId)));
+        METRIC_VALUE("network_sockets", uint64(_sockets.size()), METRIC_TAG("thread", std::to_string(_threadId)));
+
+        _scheduledUpdates = 0;
+        _lastMetricTime = now;
+    }
+
 private:
     using SocketContainer = std::vector<std::shared_ptr<SocketType>>;
 
+    // Sockets flush their send queues through Socket::ScheduleUpdate when something is queued,
+    // the sweep only picks up new sockets and updates the ones with Socket::HasPendingWork:
+    // closed or closing sockets, unsent data and pending query callbacks
+    static constexpr uint32 SWEEP_INTERVAL = 10; // ms
+
+    static inline std::atomic<uint32> _threadCounter{};
+
     std::atomic<int32> _connections{};
     std::atomic<bool> _stopped{};
 
@@ -235,6 +265,10 @@ private:
     Acore::Asio::DeadlineTimer _updateTimer;
 
     bool _proxyHeaderReadingEnabled;
+
+    uint32 _threadId;
+    uint64 _scheduledUpdates;
+    std::chrono::steady_clock::time_point _lastMetricTime;
 };
 
 #endif // NetworkThread_h__
@@ -23,14 +23,17 @@
 #include <atomic>
 #include <boost/asio.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <deque>
 #include <functional>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+#define MAX_GATHERED_WRITE_BUFFERS 64
 #ifdef BOOST_ASIO_HAS_IOCP
 #define AC_SOCKET_USE_IOCP
 #endif
@@ -47,13 +50,42 @@ enum ProxyHeaderAddressFamilyAndProtocol {
     PROXY_HEADER_ADDRESS_FAMILY_AND_PROTOCOL_TCP_V6 = 0x21,
 };
 
+/// Data waiting in the socket write queue, either owned by the queue or borrowed from an owner kept alive until it is written
+class SocketWriteBuffer
+{
+public:
+    explicit SocketWriteBuffer(MessageBuffer&& buffer) : _buffer(std::move(buffer))
+    {
+        _data = _buffer.GetReadPointer();
+        _size = _buffer.GetActiveSize();
+    }
+
+    SocketWriteBuffer(std::shared_ptr<void const> owner, uint8 const* data, std::size_t size) :
+        _buffer(0), _owner(std::move(owner)), _data(data), _size(size) { }
+
+    [[nodiscard]] uint8 const* GetReadPointer() const { return _data; }
+    [[nodiscard]] std::size_t GetActiveSize() const { return _size; }
+
+    void ReadCompleted(std::size_t bytes)
+    {
+        _data += bytes;
+        _size -= bytes;
+    }
+
+private:
+    MessageBuffer _buffer;
+    std::shared_ptr<void const> _owner;
+    uint8 const* _data;
+    std::size_t _size;
+};
+
 template<class T>
 class Socket : public std::enable_shared_from_this<T>
 {
 public:
     explicit Socket(tcp::socket&& socket) : _socket(std::move(socket)), _remoteAddress(_socket.remote_endpoint().address()),
         _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _closed(false), _closing(false), _isWritingAsync(false),
-        _proxyHeaderReadingState(PROXY_HEADER_READING_STATE_NOT_STARTED)
+        _updateScheduled(false), _proxyHeaderReadingState(PROXY_HEADER_READING_STATE_NOT_STARTED)
     {
         _readBuffer.Resize(READ_BLOCK_SIZE);
     }
@@ -141,7 +173,17 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.emplace_back(std::move(buffer));
+
+#ifdef AC_SOCKET_USE_IOCP
+        AsyncProcessQueue();
+#endif
+    }
+
+    /// Queues data without copying it, owner must keep data valid until it has been written
+    void QueuePacket(std::shared_ptr<void const> owner, uint8 const* data, std::size_t size)
+    {
+        _writeQueue.emplace_back(std::move(owner), data, size);
 
 #ifdef AC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -152,6 +194,13 @@ public:
 
     [[nodiscard]] bool IsOpen() const { return !_closed && !_closing; }
 
+    /// True if the socket has work that is not triggered by ScheduleUpdate: it is closed or closing,
+    /// or has unsent data without a write in progress. Checked by the periodic NetworkThread sweep.
+    [[nodiscard]] virtual bool HasPendingWork() const
+    {
+        return _closed || _closing || (!_isWritingAsync && !_writeQueue.empty());
+    }
+
     void CloseSocket()
     {
         if (_closed.exchange(true))
@@ -170,6 +219,19 @@ public:
     /// Marks the socket for closing after write buffer becomes empty
     void DelayedCloseSocket() { _closing = true; }
 
+    /// Requests an Update() call on the network thread owning this socket, safe to call from any thread.
+    /// Requests made before the update runs are merged into a single call.
+    void ScheduleUpdate()
+    {
+        if (_updateScheduled.exchange(true))
+            return;
+
+        boost::asio::post(_socket.get_executor(), std::bind(&Socket<T>::ScheduledUpdateHandler, this->shared_from_this()));
+    }
+
+    /// Returns how many scheduled updates the calling network thread ran since the previous call
+    static uint32 ConsumeScheduledUpdateCount() { return std::exchange(_scheduledUpdateCount, 0); }
+
     MessageBuffer& GetReadBuffer() { return _readBuffer; }
 
 protected:
@@ -184,8 +246,7 @@ protected:
         _isWritingAsync = true;
 
 #ifdef AC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        _socket.async_write_some(GatherWriteBuffers(), std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_write_some(boost::asio::null_buffers(), std::bind(&Socket<T>::WriteHandlerWrapper,
@@ -205,6 +266,47 @@ protected:
     }
 
 private:
+    /// Collects the front of the write queue into one buffer sequence so it can be sent with a single writev/WSASend
+    std::vector<boost::asio::const_buffer> const& GatherWriteBuffers()
+    {
+        _gatheredBuffers.clear();
+        for (SocketWriteBuffer const& buffer : _writeQueue)
+        {
+            _gatheredBuffers.emplace_back(buffer.GetReadPointer(), buffer.GetActiveSize());
+            if (_gatheredBuffers.size() >= MAX_GATHERED_WRITE_BUFFERS)
+                break;
+        }
+
+        return _gatheredBuffers;
+    }
+
+    /// Drops fully written buffers from the write queue and advances a partially written one
+    void WriteCompleted(std::size_t bytes)
+    {
+        while (bytes && !_writeQueue.empty())
+        {
+            SocketWriteBuffer& buffer = _writeQueue.front();
+            if (bytes < buffer.GetActiveSize())
+            {
+                buffer.ReadCompleted(bytes);
+                return;
+            }
+
+            bytes -= buffer.GetActiveSize();
+            _writeQueue.pop_front();
+        }
+    }
+
+    void ScheduledUpdateHandler()
+    {
+        // cleared first so that anything queued while updating schedules another update
+        _updateScheduled = false;
+        ++_scheduledUpdateCount;
+
+        // closed sockets are removed by the periodic NetworkThread sweep
+        Update();
+    }
+
     void ReadHandlerInternal(boost::system::error_code error, std::size_t transferredBytes)
     {
         if (error)
@@ -335,10 +437,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            WriteCompleted(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -362,12 +461,11 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::vector<boost::asio::const_buffer> const& buffers = GatherWriteBuffers();
+        std::size_t bytesToSend = boost::asio::buffer_size(buffers);
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(buffers, error);
 
         if (error)
         {
@@ -376,7 +474,7 @@ private:
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_closing && _writeQueue.empty())
             {
@@ -387,7 +485,7 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_closing && _writeQueue.empty())
             {
@@ -398,11 +496,11 @@ private:
         }
         else if (bytesSent < bytesToSend) // now n > 0
         {
-            queuedMessage.ReadCompleted(bytesSent);
+            WriteCompleted(bytesSent);
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
+        WriteCompleted(bytesSent);
 
         if (_closing && _writeQueue.empty())
         {
@@ -419,13 +517,17 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<SocketWriteBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _gatheredBuffers;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
 
     bool _isWritingAsync;
 
+    std::atomic<bool> _updateScheduled;
+    static inline thread_local uint32 _scheduledUpdateCount = 0;
+
     ProxyHeaderReadingState _proxyHeaderReadingState;
 };
 
@@ -0,0 +1,100 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Group.h"
+#include "LFGMgr.h"
+#include "LFGQueue.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace lfg;
+
+namespace
+{
+    // Every role a player can pick in the role check
+    std::vector<uint8> GetRoleChoices()
+    {
+        std::vector<uint8> choices;
+        for (uint8 roles = PLAYER_ROLE_NONE; roles <= (PLAYER_ROLE_TANK | PLAYER_ROLE_HEALER | PLAYER_ROLE_DAMAGE); roles += PLAYER_ROLE_TANK)
+            choices.push_back(roles);
+
+        return choices;
+    }
+
+    LfgRolesMap MakeRolesMap(std::vector<uint8> const& roles, std::size_t begin, std::size_t end)
+    {
+        LfgRolesMap rolesMap;
+        for (std::size_t i = begin; i < end; ++i)
+            rolesMap[ObjectGuid::Create<HighGuid::Player>(uint32(i + 1))] = roles[i] | (i ? PLAYER_ROLE_NONE : PLAYER_ROLE_LEADER);
+
+        return rolesMap;
+    }
+
+    // Compares the role compositions of a set of players, built in one go and merged from every split, with LFGMgr::CheckGroupRoles
+    void CheckRoleStates(std::vector<uint8> const& roles)
+    {
+        LfgRolesMap rolesMap = MakeRolesMap(roles, 0, roles.size());
+        LfgMatchData match(LfgDungeonSet(), rolesMap, false);
+
+        uint8 composition = LFGMgr::CheckGroupRoles(rolesMap);
+        EXPECT_EQ(match.roleStates != 0, composition != 0);
+        if (composition)
+            EXPECT_TRUE(match.roleStates & (1 << composition));
+
+        for (std::size_t split = 0; split <= roles.size(); ++split)
+        {
+            LfgMatchData merged(LfgDungeonSet(), MakeRolesMap(roles, 0, split), false);
+            merged.Merge(LfgMatchData(LfgDungeonSet(), MakeRolesMap(roles, split, roles.size()), false));
+            EXPECT_EQ(merged.roleStates, match.roleStates);
+        }
+    }
+}
+
+TEST(LFGQueueTest, RoleStatesMatchCheckGroupRoles)
+{
+    std::vector<uint8> const choices = GetRoleChoices();
+
+    for (std::size_t players = 1; players <= MAXGROUPSIZE; ++players)
+    {
+        std::vector<std::size_t> picks(players, 0);
+        while (true)
+        {
+            std::vector<uint8> roles;
+            for (std::size_t pick : picks)
+                roles.push_back(choices[pick]);
+
+            CheckRoleStates(roles);
+
+            std::size_t i = 0;
+            while (i < players && ++picks[i] == choices.size())
+                picks[i++] = 0;
+
+            if (i == players)
+                break;
+        }
+    }
+}
+
+TEST(LFGQueueTest, RoleStatesOfEmptySet)
+{
+    LfgMatchData match;
+    EXPECT_EQ(match.roleStates, 1);
+
+    LfgMatchData tank(LfgDungeonSet(), MakeRolesMap({ PLAYER_ROLE_TANK }, 0, 1), false);
+    match.Merge(tank);
+    EXPECT_EQ(match.roleStates, tank.roleStates);
+}
@@ -25,9 +25,27 @@ int main(int argc, char* argv[])
     std::string src = "Buildings";
     std::string dest = "vmaps";
 
+    // rewrite model files of already assembled vmaps in the memory mappable format
+    if (argc > 1 && std::string(argv[1]) == "--convert")
+    {
+        if (argc > 2)
+            dest = argv[2];
+
+        std::cout << "converting model files in " << dest << std::endl;
+        if (!VMAP::TileAssembler::convertModelFiles(dest))
+        {
+            std::cout << "exit with errors" << std::endl;
+            return 1;
+        }
+
+        std::cout << "Ok, all done" << std::endl;
+        return 0;
+    }
+
     if (argc > 3)
     {
         std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir>" << std::endl;
+        std::cout << "       " << argv[0] << " --convert <vmap dir>" << std::endl;
         return 1;
     }
     else